@@ -0,0 +1,419 @@
+#ifndef RAYLIB_CPP_INCLUDE_AABBTREE_HPP_
+#define RAYLIB_CPP_INCLUDE_AABBTREE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "./BroadPhase.hpp"
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Dynamic bounding volume tree broad phase over ::Rectangle or ::BoundingBox bounds, to find overlaps without testing
+ * every pair.
+ *
+ * Objects are leaves holding their bounds grown by a margin, so objects moving a little stay in place. Inserts pick
+ * the cheapest sibling by surface area and rotations keep the tree balanced. Unlike a SpatialHash it copes with
+ * objects of very different sizes and needs no tuning besides the margin.
+ *
+ * The pairs whose grown bounds touch are kept between calls to GetPairs(), and only objects that left their margin
+ * since look for new ones, so a frame costs about a tree query per such object.
+ *
+ * @code
+ * raylib::AABBTree<::BoundingBox> tree;
+ * int crate = tree.Insert(crateBox);
+ * tree.Update(crate, crateBox);
+ * tree.Query(explosionBox, hits);
+ * @endcode
+ */
+template<typename Bounds>
+class AABBTree {
+public:
+    /**
+     * @param margin Distance objects can move before they are reinserted.
+     */
+    explicit AABBTree(float margin = 0.1f) : margin(margin) {}
+
+    /**
+     * Add an object.
+     *
+     * @return Its id, reused once it is removed.
+     */
+    int Insert(const Bounds& bounds) {
+        const int leaf = Allocate();
+        Leaf& object = leaves[static_cast<size_t>(leaf)];
+        object.bounds = bounds;
+        object.box = BroadPhase<Bounds>::ToBox(bounds);
+        At(leaf).box = BroadPhase<Bounds>::Expand(object.box, margin);
+        At(leaf).height = 0;
+        InsertLeaf(leaf);
+        Moved(leaf);
+        count++;
+        return leaf;
+    }
+
+    /**
+     * Move an object.
+     *
+     * @return Whether it left its margin and was reinserted.
+     * @throws raylib::RaylibException Throws if the id is not of an object in the tree.
+     */
+    bool Update(int id, const Bounds& bounds) {
+        Leaf& object = leaves[CheckId(id)];
+        object.bounds = bounds;
+        object.box = BroadPhase<Bounds>::ToBox(bounds);
+        if (BroadPhase<Bounds>::Contains(At(id).box, object.box)) {
+            return false;
+        }
+        RemoveLeaf(id);
+        At(id).box = BroadPhase<Bounds>::Expand(object.box, margin);
+        InsertLeaf(id);
+        Moved(id);
+        return true;
+    }
+
+    /**
+     * @throws raylib::RaylibException Throws if the id is not of an object in the tree.
+     */
+    void Remove(int id) {
+        CheckId(id);
+        RemoveLeaf(id);
+        Free(id);
+        Moved(id);
+        count--;
+    }
+
+    [[nodiscard]] bool IsValid(int id) const {
+        return id >= 0 && static_cast<size_t>(id) < nodes.size() && nodes[static_cast<size_t>(id)].height == 0;
+    }
+
+    /**
+     * @throws raylib::RaylibException Throws if the id is not of an object in the tree.
+     */
+    [[nodiscard]] const Bounds& GetBounds(int id) const { return leaves[CheckId(id)].bounds; }
+
+    /**
+     * Append the ids of the objects overlapping the region.
+     *
+     * @return The number of ids appended.
+     */
+    size_t Query(const Bounds& region, std::vector<int>& result) const {
+        const ::BoundingBox box = BroadPhase<Bounds>::ToBox(region);
+        const size_t before = result.size();
+        Traverse(box, [this, &box, &result](int leaf) {
+            if (BroadPhase<Bounds>::Overlaps(leaves[static_cast<size_t>(leaf)].box, box)) {
+                result.push_back(leaf);
+            }
+        });
+        return result.size() - before;
+    }
+
+    /**
+     * Append every pair of overlapping objects once, the lower id first.
+     *
+     * @return The number of pairs appended.
+     */
+    size_t GetPairs(std::vector<std::pair<int, int>>& pairs) {
+        if (!moved.empty()) {
+            // Forget the pairs of objects that moved or went away, then look up those that moved again
+            std::erase_if(touching, [this](const std::pair<int, int>& pair) {
+                return isMoved[static_cast<size_t>(pair.first)] || isMoved[static_cast<size_t>(pair.second)];
+            });
+            for (const int id : moved) {
+                if (!IsValid(id)) {
+                    continue;
+                }
+                Traverse(At(id).box, [this, id](int other) {
+                    // Pairs of two moved objects are found from both, keep those found from the lower id
+                    if (other != id && (!isMoved[static_cast<size_t>(other)] || id < other)) {
+                        touching.emplace_back(std::min(id, other), std::max(id, other));
+                    }
+                });
+            }
+            for (const int id : moved) {
+                isMoved[static_cast<size_t>(id)] = false;
+            }
+            moved.clear();
+        }
+
+        const size_t before = pairs.size();
+        for (const auto& [a, b] : touching) {
+            if (BroadPhase<Bounds>::Overlaps(leaves[static_cast<size_t>(a)].box, leaves[static_cast<size_t>(b)].box)) {
+                pairs.emplace_back(a, b);
+            }
+        }
+        return pairs.size() - before;
+    }
+
+    void Clear() {
+        nodes.clear();
+        leaves.clear();
+        freeNodes.clear();
+        touching.clear();
+        moved.clear();
+        isMoved.clear();
+        root = null;
+        count = 0;
+    }
+
+    [[nodiscard]] size_t GetCount() const { return count; }
+
+    [[nodiscard]] float GetMargin() const { return margin; }
+
+    /** Levels below the root, 0 for a single object */
+    [[nodiscard]] int GetHeight() const { return root == null ? 0 : nodes[static_cast<size_t>(root)].height; }
+protected:
+    /**
+     * Kept small, as it is all the traversals read
+     */
+    struct Node {
+        /** Bounds with the margin for leaves, the union of the children otherwise */
+        ::BoundingBox box{};
+        int parent{-1};
+        int child1{-1};
+        int child2{-1};
+        /** 0 for leaves, -1 for free nodes */
+        int height{-1};
+    };
+
+    struct Leaf {
+        Bounds bounds{};
+        ::BoundingBox box{};
+    };
+
+    static constexpr int null = -1;
+
+    size_t CheckId(int id) const {
+        if (!IsValid(id)) {
+            throw RaylibException("AABBTree has no object with that id");
+        }
+        return static_cast<size_t>(id);
+    }
+
+    Node& At(int index) { return nodes[static_cast<size_t>(index)]; }
+
+    /**
+     * Call the function with every leaf whose grown bounds touch the box.
+     */
+    template<typename Function>
+    void Traverse(const ::BoundingBox& box, Function&& function) const {
+        if (root == null) {
+            return;
+        }
+        int stack[128];
+        int size = 0;
+        stack[size++] = root;
+        while (size > 0) {
+            const int index = stack[--size];
+            const Node& node = nodes[static_cast<size_t>(index)];
+            if (!BroadPhase<Bounds>::Touches(node.box, box)) {
+                continue;
+            }
+            if (node.height == 0) {
+                function(index);
+            } else {
+                stack[size++] = node.child1;
+                stack[size++] = node.child2;
+            }
+        }
+    }
+
+    void Moved(int id) {
+        if (isMoved.size() < nodes.size()) {
+            isMoved.resize(nodes.size(), false);
+        }
+        if (!isMoved[static_cast<size_t>(id)]) {
+            isMoved[static_cast<size_t>(id)] = true;
+            moved.push_back(id);
+        }
+    }
+
+    int Allocate() {
+        if (freeNodes.empty()) {
+            nodes.emplace_back();
+            leaves.emplace_back();
+            return static_cast<int>(nodes.size() - 1);
+        }
+        const int index = freeNodes.back();
+        freeNodes.pop_back();
+        At(index) = Node();
+        return index;
+    }
+
+    void Free(int index) {
+        At(index) = Node();
+        freeNodes.push_back(index);
+    }
+
+    void InsertLeaf(int leaf) {
+        if (root == null) {
+            root = leaf;
+            At(leaf).parent = null;
+            return;
+        }
+
+        // Descend towards the sibling that grows the tree's total cost the least
+        const ::BoundingBox box = At(leaf).box;
+        int index = root;
+        while (At(index).height > 0) {
+            const Node& node = At(index);
+            const float area = BroadPhase<Bounds>::Cost(node.box);
+            const float combined = BroadPhase<Bounds>::Cost(BroadPhase<Bounds>::Union(node.box, box));
+            const float cost = 2.0f * combined;
+            const float inheritance = 2.0f * (combined - area);
+            const float cost1 = ChildCost(node.child1, box) + inheritance;
+            const float cost2 = ChildCost(node.child2, box) + inheritance;
+            if (cost < cost1 && cost < cost2) {
+                break;
+            }
+            index = cost1 < cost2 ? node.child1 : node.child2;
+        }
+
+        const int sibling = index;
+        const int oldParent = At(sibling).parent;
+        const int newParent = Allocate();
+        Node& parent = At(newParent);
+        parent.parent = oldParent;
+        parent.box = BroadPhase<Bounds>::Union(box, At(sibling).box);
+        parent.height = At(sibling).height + 1;
+        parent.child1 = sibling;
+        parent.child2 = leaf;
+        At(sibling).parent = newParent;
+        At(leaf).parent = newParent;
+        if (oldParent == null) {
+            root = newParent;
+        } else if (At(oldParent).child1 == sibling) {
+            At(oldParent).child1 = newParent;
+        } else {
+            At(oldParent).child2 = newParent;
+        }
+        Refit(newParent);
+    }
+
+    void RemoveLeaf(int leaf) {
+        if (leaf == root) {
+            root = null;
+            return;
+        }
+        const int parent = At(leaf).parent;
+        const int grandParent = At(parent).parent;
+        const int sibling = At(parent).child1 == leaf ? At(parent).child2 : At(parent).child1;
+        At(sibling).parent = grandParent;
+        if (grandParent == null) {
+            root = sibling;
+        } else {
+            if (At(grandParent).child1 == parent) {
+                At(grandParent).child1 = sibling;
+            } else {
+                At(grandParent).child2 = sibling;
+            }
+            Refit(grandParent);
+        }
+        Free(parent);
+    }
+
+    /**
+     * Cost of making the leaf a sibling of the child, or of a node below it
+     */
+    float ChildCost(int child, const ::BoundingBox& box) {
+        const Node& node = At(child);
+        const float combined = BroadPhase<Bounds>::Cost(BroadPhase<Bounds>::Union(node.box, box));
+        return node.height == 0 ? combined : combined - BroadPhase<Bounds>::Cost(node.box);
+    }
+
+    /**
+     * Rebalance and update the bounds and heights from the node up to the root.
+     */
+    void Refit(int index) {
+        while (index != null) {
+            index = Balance(index);
+            Node& node = At(index);
+            node.height = 1 + std::max(At(node.child1).height, At(node.child2).height);
+            node.box = BroadPhase<Bounds>::Union(At(node.child1).box, At(node.child2).box);
+            index = node.parent;
+        }
+    }
+
+    /**
+     * Rotate the taller grandchild up when the children's heights differ by more than one.
+     *
+     * @return The node now in its place.
+     */
+    int Balance(int a) {
+        Node& nodeA = At(a);
+        if (nodeA.height < 2) {
+            return a;
+        }
+        const int b = nodeA.child1;
+        const int c = nodeA.child2;
+        const int balance = At(c).height - At(b).height;
+        if (balance > 1) {
+            Rotate(a, c, false);
+            return c;
+        }
+        if (balance < -1) {
+            Rotate(a, b, true);
+            return b;
+        }
+        return a;
+    }
+
+    /**
+     * Move the child up in place of its parent a, which takes the child's shorter child.
+     */
+    void Rotate(int a, int up, bool left) {
+        Node& nodeA = At(a);
+        Node& nodeUp = At(up);
+        const int other = left ? nodeA.child2 : nodeA.child1;
+        const int f = nodeUp.child1;
+        const int g = nodeUp.child2;
+        const int tall = At(f).height > At(g).height ? f : g;
+        const int shortChild = tall == f ? g : f;
+
+        nodeUp.child1 = a;
+        nodeUp.parent = nodeA.parent;
+        nodeA.parent = up;
+        if (nodeUp.parent == null) {
+            root = up;
+        } else if (At(nodeUp.parent).child1 == a) {
+            At(nodeUp.parent).child1 = up;
+        } else {
+            At(nodeUp.parent).child2 = up;
+        }
+
+        nodeUp.child2 = tall;
+        if (left) {
+            nodeA.child1 = shortChild;
+        } else {
+            nodeA.child2 = shortChild;
+        }
+        At(shortChild).parent = a;
+        nodeA.box = BroadPhase<Bounds>::Union(At(other).box, At(shortChild).box);
+        nodeUp.box = BroadPhase<Bounds>::Union(nodeA.box, At(tall).box);
+        nodeA.height = 1 + std::max(At(other).height, At(shortChild).height);
+        nodeUp.height = 1 + std::max(nodeA.height, At(tall).height);
+    }
+
+    float margin{0.1f};
+    std::vector<Node> nodes{};
+    /** Bounds of the objects, by node */
+    std::vector<Leaf> leaves{};
+    std::vector<int> freeNodes{};
+    int root{null};
+    size_t count{0};
+    /** Pairs of objects whose grown bounds touch, as of the last GetPairs() */
+    std::vector<std::pair<int, int>> touching{};
+    /** Objects inserted, reinserted or removed since the last GetPairs() */
+    std::vector<int> moved{};
+    std::vector<bool> isMoved{};
+};
+} // namespace raylib
+
+template<typename Bounds>
+using RAABBTree = raylib::AABBTree<Bounds>;
+
+#endif // RAYLIB_CPP_INCLUDE_AABBTREE_HPP_
@@ -0,0 +1,438 @@
+#ifndef RAYLIB_CPP_INCLUDE_ANIMATIONCLIP_HPP_
+#define RAYLIB_CPP_INCLUDE_ANIMATIONCLIP_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Compressed animation that can be sampled at any time.
+ *
+ * Each bone keeps only the keyframes that linear interpolation cannot reproduce within the tolerances, and rotations
+ * are quantized to 48 bits. Poses hold the same model space bone transforms as ::ModelAnimation::framePoses.
+ *
+ * @code
+ * raylib::AnimationClip walk(animations[0]);
+ * std::vector<::Transform> pose(walk.GetBoneCount());
+ * std::vector<::Matrix> bones(walk.GetBoneCount());
+ * walk.Sample(GetTime(), pose);
+ * raylib::SkinningEngine::ComputeBoneMatrices(model, pose, bones);
+ * skinning.Update(model, bones);
+ * @endcode
+ */
+class AnimationClip {
+public:
+    AnimationClip() = default;
+
+    /**
+     * Compress an animation.
+     *
+     * @param frameRate Frames per second the animation was sampled at.
+     * @param translationTolerance Largest error allowed on translations, in model units.
+     * @param rotationTolerance Largest error allowed on rotations, in radians.
+     * @param scaleTolerance Largest error allowed on scales.
+     *
+     * @throws raylib::RaylibException Throws if the animation has no frames or more than 65536 of them.
+     */
+    explicit AnimationClip(
+        const ::ModelAnimation& animation,
+        float frameRate = 60.0f,
+        float translationTolerance = 0.0005f,
+        float rotationTolerance = 0.001f,
+        float scaleTolerance = 0.0005f) {
+        Load(animation, frameRate, translationTolerance, rotationTolerance, scaleTolerance);
+    }
+
+    /**
+     * @see AnimationClip()
+     */
+    void Load(
+        const ::ModelAnimation& animation,
+        float frameRate = 60.0f,
+        float translationTolerance = 0.0005f,
+        float rotationTolerance = 0.001f,
+        float scaleTolerance = 0.0005f) {
+        if (animation.frameCount <= 0 || animation.frameCount > 65536 || animation.boneCount < 0 ||
+            animation.framePoses == nullptr || frameRate <= 0.0f) {
+            throw RaylibException("AnimationClip requires between 1 and 65536 frames and a positive frame rate");
+        }
+
+        name = std::string(animation.name, strnlen(animation.name, sizeof(animation.name)));
+        boneCount = static_cast<size_t>(animation.boneCount);
+        frameCount = static_cast<size_t>(animation.frameCount);
+        this->frameRate = frameRate;
+        translations.Clear(boneCount);
+        rotations.Clear(boneCount);
+        scales.Clear(boneCount);
+
+        std::vector<::Vector3> vectors(frameCount);
+        std::vector<::Quaternion> quaternions(frameCount);
+        for (size_t bone = 0; bone < boneCount; bone++) {
+            for (size_t frame = 0; frame < frameCount; frame++) {
+                vectors[frame] = animation.framePoses[frame][bone].translation;
+            }
+            translations.Add(bone, vectors, translationTolerance);
+
+            for (size_t frame = 0; frame < frameCount; frame++) {
+                quaternions[frame] = animation.framePoses[frame][bone].rotation;
+            }
+            rotations.Add(bone, quaternions, rotationTolerance);
+
+            for (size_t frame = 0; frame < frameCount; frame++) {
+                vectors[frame] = animation.framePoses[frame][bone].scale;
+            }
+            scales.Add(bone, vectors, scaleTolerance);
+        }
+    }
+
+    GETTER(std::string, Name, name)
+    GETTER(float, FrameRate, frameRate)
+
+    [[nodiscard]] int GetBoneCount() const { return static_cast<int>(boneCount); }
+
+    [[nodiscard]] int GetFrameCount() const { return static_cast<int>(frameCount); }
+
+    /**
+     * Length of one loop in seconds, including the step from the last frame back to the first.
+     */
+    [[nodiscard]] float GetDuration() const { return static_cast<float>(frameCount) / frameRate; }
+
+    /**
+     * Keyframes kept over all bones and channels, out of three per bone and frame before compression.
+     */
+    [[nodiscard]] size_t GetKeyCount() const {
+        return translations.frames.size() + rotations.frames.size() + scales.frames.size();
+    }
+
+    /**
+     * Bytes used by the keyframes, to compare against GetBoneCount() * GetFrameCount() * sizeof(::Transform).
+     */
+    [[nodiscard]] size_t GetDataSize() const {
+        return translations.GetDataSize() + rotations.GetDataSize() + scales.GetDataSize();
+    }
+
+    /**
+     * Pose of the bones at a time in seconds, interpolating between frames.
+     *
+     * @param loop Wrap the time around and interpolate from the last frame back to the first, otherwise clamp it.
+     */
+    void Sample(float time, std::span<::Transform> pose, bool loop = true) const {
+        const float frame = GetFrame(time, loop);
+        const size_t count = std::min(pose.size(), boneCount);
+        for (size_t bone = 0; bone < count; bone++) {
+            pose[bone] = SampleBone(bone, frame, loop);
+        }
+    }
+
+    /**
+     * Pose blended from two clips of the same skeleton, weight 0 giving the first clip and 1 the second.
+     */
+    static void Blend(
+        const AnimationClip& first,
+        float firstTime,
+        const AnimationClip& second,
+        float secondTime,
+        float weight,
+        std::span<::Transform> pose,
+        bool loop = true) {
+        const float firstFrame = first.GetFrame(firstTime, loop);
+        const float secondFrame = second.GetFrame(secondTime, loop);
+        const size_t count = std::min({pose.size(), first.boneCount, second.boneCount});
+        for (size_t bone = 0; bone < count; bone++) {
+            pose[bone] = Blend(
+                first.SampleBone(bone, firstFrame, loop),
+                second.SampleBone(bone, secondFrame, loop),
+                weight);
+        }
+    }
+
+    /**
+     * Interpolate between two poses, weight 0 giving the first pose and 1 the second.
+     */
+    static void Blend(
+        std::span<const ::Transform> first,
+        std::span<const ::Transform> second,
+        float weight,
+        std::span<::Transform> pose) {
+        const size_t count = std::min({pose.size(), first.size(), second.size()});
+        for (size_t bone = 0; bone < count; bone++) {
+            pose[bone] = Blend(first[bone], second[bone], weight);
+        }
+    }
+
+    /**
+     * Interpolate between two transforms, taking the shortest path between the rotations.
+     */
+    static ::Transform Blend(const ::Transform& first, const ::Transform& second, float weight) {
+        return {
+            Lerp(first.translation, second.translation, weight),
+            Nlerp(first.rotation, second.rotation, weight),
+            Lerp(first.scale, second.scale, weight)};
+    }
+protected:
+    /**
+     * Rotation in 48 bits, storing the three smallest components in 15 bits each and the index of the largest one in
+     * the top bits of the first two values.
+     */
+    struct PackedQuaternion {
+        uint16_t values[3]{};
+    };
+
+    static constexpr float maxSmallComponent = 0.70710678f;
+
+    struct VectorCodec {
+        using Value = ::Vector3;
+        using Stored = ::Vector3;
+
+        static Stored Encode(const Value& value) { return value; }
+
+        static Value Decode(const Stored& stored) { return stored; }
+
+        static Value Interpolate(const Value& a, const Value& b, float t) { return Lerp(a, b, t); }
+
+        static float Distance(const Value& a, const Value& b) {
+            const float x = a.x - b.x;
+            const float y = a.y - b.y;
+            const float z = a.z - b.z;
+            return std::sqrt(x * x + y * y + z * z);
+        }
+    };
+
+    struct QuaternionCodec {
+        using Value = ::Quaternion;
+        using Stored = PackedQuaternion;
+
+        static Stored Encode(const Value& value) {
+            float components[4] = {value.x, value.y, value.z, value.w};
+            const float length = std::sqrt(Dot(value, value));
+            size_t largest = 0;
+            for (size_t i = 0; i < 4; i++) {
+                components[i] = length > 0.0f ? components[i] / length : (i == 3 ? 1.0f : 0.0f);
+                if (std::fabs(components[i]) > std::fabs(components[largest])) {
+                    largest = i;
+                }
+            }
+            // q and -q are the same rotation, so the dropped component can always be positive
+            const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+
+            Stored stored;
+            size_t j = 0;
+            for (size_t i = 0; i < 4; i++) {
+                if (i == largest) {
+                    continue;
+                }
+                const float normalized = std::clamp(sign * components[i] / maxSmallComponent, -1.0f, 1.0f);
+                stored.values[j++] = static_cast<uint16_t>(std::lround((normalized * 0.5f + 0.5f) * 32767.0f));
+            }
+            stored.values[0] = static_cast<uint16_t>(stored.values[0] | ((largest & 1u) << 15));
+            stored.values[1] = static_cast<uint16_t>(stored.values[1] | ((largest >> 1) << 15));
+            return stored;
+        }
+
+        static Value Decode(const Stored& stored) {
+            const size_t largest = static_cast<size_t>(stored.values[0] >> 15) |
+                                   (static_cast<size_t>(stored.values[1] >> 15) << 1);
+            float components[4];
+            float sum = 0.0f;
+            size_t j = 0;
+            for (size_t i = 0; i < 4; i++) {
+                if (i == largest) {
+                    continue;
+                }
+                const float normalized = static_cast<float>(stored.values[j++] & 0x7fff) / 32767.0f * 2.0f - 1.0f;
+                components[i] = normalized * maxSmallComponent;
+                sum += components[i] * components[i];
+            }
+            components[largest] = std::sqrt(std::max(0.0f, 1.0f - sum));
+            return {components[0], components[1], components[2], components[3]};
+        }
+
+        static Value Interpolate(const Value& a, const Value& b, float t) { return Nlerp(a, b, t); }
+
+        /**
+         * Angle between the rotations, from the chord between the unit quaternions as acos() is too coarse near 1
+         */
+        static float Distance(const Value& a, const Value& b) {
+            const float lengthA = std::sqrt(Dot(a, a));
+            const float lengthB = std::sqrt(Dot(b, b));
+            if (lengthA <= 0.0f || lengthB <= 0.0f) {
+                return 0.0f;
+            }
+            const float scaleB = (Dot(a, b) < 0.0f ? -1.0f : 1.0f) / lengthB;
+            const float x = a.x / lengthA - b.x * scaleB;
+            const float y = a.y / lengthA - b.y * scaleB;
+            const float z = a.z / lengthA - b.z * scaleB;
+            const float w = a.w / lengthA - b.w * scaleB;
+            return 4.0f * std::asin(std::min(std::sqrt(x * x + y * y + z * z + w * w) * 0.5f, 1.0f));
+        }
+    };
+
+    /**
+     * Keyframes of one channel for all bones, stored back to back.
+     */
+    template<typename Codec>
+    struct Track {
+        struct Range {
+            uint32_t first{0};
+            uint32_t count{0};
+        };
+
+        std::vector<Range> bones{};
+        std::vector<uint16_t> frames{};
+        std::vector<typename Codec::Stored> keys{};
+
+        void Clear(size_t boneCount) {
+            bones.assign(boneCount, Range{});
+            frames.clear();
+            keys.clear();
+        }
+
+        [[nodiscard]] size_t GetDataSize() const {
+            return bones.size() * sizeof(Range) + frames.size() * sizeof(uint16_t) +
+                   keys.size() * sizeof(typename Codec::Stored);
+        }
+
+        /**
+         * Greedily extend each segment while interpolating its decoded end keys stays within tolerance of every
+         * frame it spans.
+         */
+        void Add(size_t bone, const std::vector<typename Codec::Value>& samples, float tolerance) {
+            bones[bone].first = static_cast<uint32_t>(frames.size());
+            const auto push = [this, &samples](size_t frame) {
+                frames.push_back(static_cast<uint16_t>(frame));
+                keys.push_back(Codec::Encode(samples[frame]));
+            };
+
+            push(0);
+            size_t start = 0;
+            while (start + 1 < samples.size()) {
+                const typename Codec::Value startValue = Codec::Decode(keys.back());
+                size_t end = start + 1;
+                while (end + 1 < samples.size() && Fits(samples, start, end + 1, startValue, tolerance)) {
+                    end++;
+                }
+                push(end);
+                start = end;
+            }
+
+            // A constant channel needs only its first key
+            const size_t count = frames.size() - bones[bone].first;
+            if (count == 2 && memcmp(&keys.back(), &keys[keys.size() - 2], sizeof(typename Codec::Stored)) == 0) {
+                frames.pop_back();
+                keys.pop_back();
+            }
+            bones[bone].count = static_cast<uint32_t>(frames.size() - bones[bone].first);
+        }
+
+        static bool Fits(
+            const std::vector<typename Codec::Value>& samples,
+            size_t start,
+            size_t end,
+            const typename Codec::Value& startValue,
+            float tolerance) {
+            const typename Codec::Value endValue = Codec::Decode(Codec::Encode(samples[end]));
+            const auto length = static_cast<float>(end - start);
+            for (size_t frame = start + 1; frame < end; frame++) {
+                const float t = static_cast<float>(frame - start) / length;
+                if (Codec::Distance(Codec::Interpolate(startValue, endValue, t), samples[frame]) > tolerance) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Value at a fractional frame, where frames past the last one interpolate back to the first when looping.
+         */
+        [[nodiscard]] typename Codec::Value Sample(size_t bone, float frame, float lastFrame, bool loop) const {
+            const Range range = bones[bone];
+            const uint16_t* begin = frames.data() + range.first;
+            const uint16_t* end = begin + range.count;
+            const typename Codec::Stored* values = keys.data() + range.first;
+
+            if (frame >= lastFrame) {
+                const typename Codec::Value last = Codec::Decode(values[range.count - 1]);
+                if (!loop || frame == lastFrame) {
+                    return last;
+                }
+                return Codec::Interpolate(last, Codec::Decode(values[0]), frame - lastFrame);
+            }
+
+            // First key after the frame, which exists as the last frame always holds a key when there are several
+            const uint16_t* next = std::upper_bound(begin, end, static_cast<uint16_t>(frame));
+            if (next == end) {
+                return Codec::Decode(values[range.count - 1]);
+            }
+            const auto index = static_cast<size_t>(next - begin);
+            const float previousFrame = static_cast<float>(begin[index - 1]);
+            const float t = (frame - previousFrame) / (static_cast<float>(*next) - previousFrame);
+            return Codec::Interpolate(Codec::Decode(values[index - 1]), Codec::Decode(values[index]), t);
+        }
+    };
+
+    [[nodiscard]] float GetFrame(float time, bool loop) const {
+        const float frame = time * frameRate;
+        const auto count = static_cast<float>(frameCount);
+        if (loop) {
+            const float wrapped = std::fmod(frame, count);
+            return wrapped < 0.0f ? wrapped + count : wrapped;
+        }
+        return std::clamp(frame, 0.0f, count - 1.0f);
+    }
+
+    [[nodiscard]] ::Transform SampleBone(size_t bone, float frame, bool loop) const {
+        const auto lastFrame = static_cast<float>(frameCount - 1);
+        return {
+            translations.Sample(bone, frame, lastFrame, loop),
+            rotations.Sample(bone, frame, lastFrame, loop),
+            scales.Sample(bone, frame, lastFrame, loop)};
+    }
+
+    static float Dot(const ::Quaternion& a, const ::Quaternion& b) {
+        return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+    }
+
+    static ::Vector3 Lerp(const ::Vector3& a, const ::Vector3& b, float t) {
+        return {a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t};
+    }
+
+    /**
+     * Normalized linear interpolation along the shortest arc
+     */
+    static ::Quaternion Nlerp(const ::Quaternion& a, const ::Quaternion& b, float t) {
+        const float sign = Dot(a, b) < 0.0f ? -1.0f : 1.0f;
+        ::Quaternion result{
+            a.x + (sign * b.x - a.x) * t,
+            a.y + (sign * b.y - a.y) * t,
+            a.z + (sign * b.z - a.z) * t,
+            a.w + (sign * b.w - a.w) * t};
+        const float length = std::sqrt(Dot(result, result));
+        if (length > 0.0f) {
+            result = {result.x / length, result.y / length, result.z / length, result.w / length};
+        }
+        return result;
+    }
+
+    std::string name{};
+    size_t boneCount{0};
+    size_t frameCount{0};
+    float frameRate{60.0f};
+    Track<VectorCodec> translations{};
+    Track<QuaternionCodec> rotations{};
+    Track<VectorCodec> scales{};
+};
+} // namespace raylib
+
+using RAnimationClip = raylib::AnimationClip;
+
+#endif // RAYLIB_CPP_INCLUDE_ANIMATIONCLIP_HPP_
@@ -0,0 +1,284 @@
+#ifndef RAYLIB_CPP_INCLUDE_ANIMATIONPOSECACHE_HPP_
+#define RAYLIB_CPP_INCLUDE_ANIMATIONPOSECACHE_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "./AnimationClip.hpp"
+#include "./RaylibException.hpp"
+#include "./SkinningEngine.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Bone matrices shared between models that play the same animation at the same frame.
+ *
+ * Poses are keyed by skeleton, animation and frame, or time rounded to a step for an AnimationClip. Models loaded
+ * separately from the same file count as one skeleton, as skeletons are compared by their bind pose. Call
+ * NextFrame() once per frame to drop the poses that are no longer played.
+ *
+ * @code
+ * raylib::AnimationPoseCache poses;
+ * for (Npc& npc : npcs) {
+ *     poses.UpdateBones(npc.model, animations[npc.clip], npc.frame);
+ * }
+ * poses.NextFrame();
+ * @endcode
+ */
+class AnimationPoseCache {
+public:
+    /**
+     * Animation and frame to pose a model with, for BuildPalette().
+     */
+    struct Instance {
+        const ::ModelAnimation* animation{nullptr};
+        int frame{0};
+    };
+
+    /**
+     * @param timeSteps Poses sampled per animation frame for AnimationClip times, more is smoother and less shared.
+     */
+    explicit AnimationPoseCache(int timeSteps = 1) : timeSteps(std::max(timeSteps, 1)) {}
+
+    /**
+     * Bone matrices of the model posed by a frame of the animation, as ::UpdateModelAnimationBones() computes them.
+     *
+     * The span stays valid until the pose is dropped by NextFrame() or Clear().
+     *
+     * @throws raylib::RaylibException Throws if the animation does not match the skeleton of the model.
+     */
+    std::span<const ::Matrix> Get(const ::Model& model, const ::ModelAnimation& animation, int frame) {
+        if (animation.frameCount <= 0) {
+            throw RaylibException("ModelAnimation has no frames");
+        }
+        frame %= animation.frameCount;
+        frame = frame < 0 ? frame + animation.frameCount : frame;
+
+        const Key key{GetSkeleton(model), &animation, frame};
+        Entry& entry = Find(key);
+        if (entry.bones.empty()) {
+            // A failed pose is dropped rather than left as zero matrices for the next lookup to hit
+            std::vector<::Matrix> bones(static_cast<size_t>(model.boneCount));
+            try {
+                SkinningEngine::ComputeBoneMatrices(model, animation, frame, bones);
+            } catch (...) {
+                entries.erase(key);
+                throw;
+            }
+            entry.bones = std::move(bones);
+        }
+        return entry.bones;
+    }
+
+    /**
+     * Bone matrices of the model posed by the clip at a time in seconds, rounded to 1 / (frame rate * timeSteps).
+     */
+    std::span<const ::Matrix> Get(const ::Model& model, const AnimationClip& clip, float time, bool loop = true) {
+        if (clip.GetFrameCount() <= 0) {
+            throw RaylibException("AnimationClip has no frames");
+        }
+        const auto stepsPerSecond = static_cast<double>(clip.GetFrameRate()) * timeSteps;
+        const auto stepCount = static_cast<int64_t>(clip.GetFrameCount()) * timeSteps;
+        auto step = static_cast<int64_t>(std::llround(static_cast<double>(time) * stepsPerSecond));
+        if (loop) {
+            step %= stepCount;
+            step = step < 0 ? step + stepCount : step;
+        } else {
+            step = std::clamp<int64_t>(step, 0, stepCount - timeSteps);
+        }
+
+        const Key key{GetSkeleton(model), &clip, step};
+        Entry& entry = Find(key);
+        if (entry.bones.empty()) {
+            std::vector<::Transform> pose(static_cast<size_t>(clip.GetBoneCount()));
+            std::vector<::Matrix> bones(pose.size());
+            try {
+                clip.Sample(static_cast<float>(static_cast<double>(step) / stepsPerSecond), pose, loop);
+                SkinningEngine::ComputeBoneMatrices(model, pose, bones);
+            } catch (...) {
+                entries.erase(key);
+                throw;
+            }
+            entry.bones = std::move(bones);
+        }
+        return entry.bones;
+    }
+
+    /**
+     * Copy the shared pose into the bone matrices of the meshes, replacing Model::UpdateAnimationBones().
+     */
+    AnimationPoseCache& UpdateBones(::Model& model, const ::ModelAnimation& animation, int frame) {
+        SetBones(model, Get(model, animation, frame));
+        return *this;
+    }
+
+    /**
+     * Copy the shared pose of the clip into the bone matrices of the meshes.
+     */
+    AnimationPoseCache& UpdateBones(::Model& model, const AnimationClip& clip, float time, bool loop = true) {
+        SetBones(model, Get(model, clip, time, loop));
+        return *this;
+    }
+
+    /**
+     * Pack the distinct poses of the instances back to back into one palette, for instanced skinned drawing.
+     *
+     * @param offsets Receives the index in the palette of the first bone matrix of each instance.
+     * @return The palette, valid until the next call.
+     */
+    std::span<const ::Matrix> BuildPalette(
+        const ::Model& model,
+        std::span<const Instance> instances,
+        std::span<int> offsets) {
+        if (offsets.size() < instances.size()) {
+            throw RaylibException("BuildPalette() requires an offset per instance");
+        }
+
+        palette.clear();
+        std::unordered_map<const ::Matrix*, int> packed;
+        for (size_t i = 0; i < instances.size(); i++) {
+            if (instances[i].animation == nullptr) {
+                throw RaylibException("BuildPalette() requires an animation per instance");
+            }
+            const std::span<const ::Matrix> bones = Get(model, *instances[i].animation, instances[i].frame);
+            const auto [position, added] = packed.try_emplace(bones.data(), static_cast<int>(palette.size()));
+            if (added) {
+                palette.insert(palette.end(), bones.begin(), bones.end());
+            }
+            offsets[i] = position->second;
+        }
+        return palette;
+    }
+
+    /**
+     * Drop the poses that were not used since the last maxIdleFrames calls, and start a new frame.
+     */
+    AnimationPoseCache& NextFrame(int maxIdleFrames = 1) {
+        for (auto entry = entries.begin(); entry != entries.end();) {
+            if (currentFrame - entry->second.lastUsed >= static_cast<uint64_t>(std::max(maxIdleFrames, 1))) {
+                entry = entries.erase(entry);
+            } else {
+                ++entry;
+            }
+        }
+        currentFrame++;
+        return *this;
+    }
+
+    /**
+     * Drop all poses and skeletons, i.e. after unloading the models.
+     */
+    void Clear() {
+        entries.clear();
+        skeletonIds.clear();
+        skeletons.clear();
+        palette.clear();
+    }
+
+    /** Poses computed since the last ResetStatistics() */
+    [[nodiscard]] size_t GetMissCount() const { return missCount; }
+
+    /** Poses shared instead of computed since the last ResetStatistics() */
+    [[nodiscard]] size_t GetHitCount() const { return hitCount; }
+
+    [[nodiscard]] size_t GetPoseCount() const { return entries.size(); }
+
+    void ResetStatistics() {
+        hitCount = 0;
+        missCount = 0;
+    }
+protected:
+    struct Key {
+        size_t skeleton{0};
+        const void* animation{nullptr};
+        int64_t frame{0};
+
+        bool operator==(const Key& other) const {
+            return skeleton == other.skeleton && animation == other.animation && frame == other.frame;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            size_t hash = std::hash<const void*>()(key.animation);
+            hash ^= key.skeleton + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<int64_t>()(key.frame) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+    };
+
+    struct Entry {
+        std::vector<::Matrix> bones{};
+        uint64_t lastUsed{0};
+    };
+
+    Entry& Find(const Key& key) {
+        Entry& entry = entries[key];
+        if (entry.bones.empty()) {
+            missCount++;
+        } else {
+            hitCount++;
+        }
+        entry.lastUsed = currentFrame;
+        return entry;
+    }
+
+    /**
+     * Identify the skeleton by its bind pose contents, so separately loaded copies of a model share their poses.
+     */
+    size_t GetSkeleton(const ::Model& model) {
+        if (model.bindPose == nullptr || model.boneCount <= 0) {
+            throw RaylibException("Model has no skeleton");
+        }
+        const std::span<const ::Transform> bindPose(model.bindPose, static_cast<size_t>(model.boneCount));
+        const auto matches = [bindPose](const std::vector<::Transform>& skeleton) {
+            return skeleton.size() == bindPose.size() &&
+                   memcmp(skeleton.data(), bindPose.data(), bindPose.size_bytes()) == 0;
+        };
+
+        // Checking the contents again catches a bind pose array reused by another model after an unload
+        const auto known = skeletonIds.find(model.bindPose);
+        if (known != skeletonIds.end() && matches(skeletons[known->second])) {
+            return known->second;
+        }
+
+        const auto same = std::find_if(skeletons.begin(), skeletons.end(), matches);
+        size_t id = static_cast<size_t>(same - skeletons.begin());
+        if (same == skeletons.end()) {
+            skeletons.emplace_back(bindPose.begin(), bindPose.end());
+        }
+        skeletonIds[model.bindPose] = id;
+        return id;
+    }
+
+    static void SetBones(::Model& model, std::span<const ::Matrix> bones) {
+        for (int i = 0; i < model.meshCount; i++) {
+            ::Mesh& mesh = model.meshes[i];
+            if (mesh.boneMatrices != nullptr) {
+                const size_t count = std::min(bones.size(), static_cast<size_t>(std::max(mesh.boneCount, 0)));
+                std::copy_n(bones.begin(), count, mesh.boneMatrices);
+            }
+        }
+    }
+
+    int timeSteps{1};
+    uint64_t currentFrame{0};
+    std::unordered_map<Key, Entry, KeyHash> entries{};
+    std::unordered_map<const ::Transform*, size_t> skeletonIds{};
+    std::vector<std::vector<::Transform>> skeletons{};
+    std::vector<::Matrix> palette{};
+    size_t hitCount{0};
+    size_t missCount{0};
+};
+} // namespace raylib
+
+using RAnimationPoseCache = raylib::AnimationPoseCache;
+
+#endif // RAYLIB_CPP_INCLUDE_ANIMATIONPOSECACHE_HPP_
@@ -1,8 +1,16 @@
 #ifndef RAYLIB_CPP_INCLUDE_BOUNDINGBOX_HPP_
 #define RAYLIB_CPP_INCLUDE_BOUNDINGBOX_HPP_
 
+#include <algorithm>
+#include <cstddef>
+
 #include "./raylib-cpp-utils.hpp"
 #include "./RayCollision.hpp"
+#include "./SweptCollision.hpp"
+
+#ifdef RAYLIB_CPP_SSE2
+#include <emmintrin.h>
+#endif
 
 namespace raylib {
 /**
@@ -33,6 +41,106 @@ public:
         return *this;
     }
 
+    /**
+     * Compute the limits of packed xyz positions, like ::Mesh::vertices.
+     *
+     * Returns an empty box at the origin when there are no points.
+     */
+    static BoundingBox FromPoints(const float* points, size_t count) {
+        if (points == nullptr || count == 0) {
+            return BoundingBox();
+        }
+
+        float boxMin[3] = {points[0], points[1], points[2]};
+        float boxMax[3] = {points[0], points[1], points[2]};
+        size_t i = 1;
+#ifdef RAYLIB_CPP_SSE2
+        if (count >= 4) {
+            // Four points are three registers, with the lanes holding [x y z x], [y z x y] and [z x y z]
+            __m128 min0 = _mm_loadu_ps(points);
+            __m128 min1 = _mm_loadu_ps(points + 4);
+            __m128 min2 = _mm_loadu_ps(points + 8);
+            __m128 max0 = min0;
+            __m128 max1 = min1;
+            __m128 max2 = min2;
+            for (i = 4; i + 4 <= count; i += 4) {
+                const float* p = points + i * 3;
+                const __m128 p0 = _mm_loadu_ps(p);
+                const __m128 p1 = _mm_loadu_ps(p + 4);
+                const __m128 p2 = _mm_loadu_ps(p + 8);
+                min0 = _mm_min_ps(min0, p0);
+                min1 = _mm_min_ps(min1, p1);
+                min2 = _mm_min_ps(min2, p2);
+                max0 = _mm_max_ps(max0, p0);
+                max1 = _mm_max_ps(max1, p1);
+                max2 = _mm_max_ps(max2, p2);
+            }
+
+            float lanesMin[12];
+            float lanesMax[12];
+            _mm_storeu_ps(lanesMin, min0);
+            _mm_storeu_ps(lanesMin + 4, min1);
+            _mm_storeu_ps(lanesMin + 8, min2);
+            _mm_storeu_ps(lanesMax, max0);
+            _mm_storeu_ps(lanesMax + 4, max1);
+            _mm_storeu_ps(lanesMax + 8, max2);
+            for (size_t lane = 0; lane < 12; lane++) {
+                boxMin[lane % 3] = std::min(boxMin[lane % 3], lanesMin[lane]);
+                boxMax[lane % 3] = std::max(boxMax[lane % 3], lanesMax[lane]);
+            }
+        }
+#endif
+        for (; i < count; i++) {
+            for (size_t axis = 0; axis < 3; axis++) {
+                boxMin[axis] = std::min(boxMin[axis], points[i * 3 + axis]);
+                boxMax[axis] = std::max(boxMax[axis], points[i * 3 + axis]);
+            }
+        }
+
+        return {::Vector3{boxMin[0], boxMin[1], boxMin[2]}, ::Vector3{boxMax[0], boxMax[1], boxMax[2]}};
+    }
+
+    /**
+     * Get the box around this box after transforming it by the matrix.
+     *
+     * Runs in constant time by taking the extremes of each matrix element times the box limits (Arvo's method),
+     * which is exact for translations and scales, and conservative under rotation.
+     */
+    [[nodiscard]] BoundingBox Transform(const ::Matrix& matrix) const {
+        const float rows[3][4] = {
+            {matrix.m0, matrix.m4, matrix.m8, matrix.m12},
+            {matrix.m1, matrix.m5, matrix.m9, matrix.m13},
+            {matrix.m2, matrix.m6, matrix.m10, matrix.m14}};
+        const float boxMin[3] = {min.x, min.y, min.z};
+        const float boxMax[3] = {max.x, max.y, max.z};
+
+        float resultMin[3];
+        float resultMax[3];
+        for (int i = 0; i < 3; i++) {
+            resultMin[i] = rows[i][3];
+            resultMax[i] = rows[i][3];
+            for (int j = 0; j < 3; j++) {
+                const float a = rows[i][j] * boxMin[j];
+                const float b = rows[i][j] * boxMax[j];
+                resultMin[i] += std::min(a, b);
+                resultMax[i] += std::max(a, b);
+            }
+        }
+
+        return {
+            ::Vector3{resultMin[0], resultMin[1], resultMin[2]},
+            ::Vector3{resultMax[0], resultMax[1], resultMax[2]}};
+    }
+
+    /**
+     * Get the box enclosing both boxes
+     */
+    [[nodiscard]] BoundingBox Merge(const ::BoundingBox& box) const {
+        return {
+            ::Vector3{std::min(min.x, box.min.x), std::min(min.y, box.min.y), std::min(min.z, box.min.z)},
+            ::Vector3{std::max(max.x, box.max.x), std::max(max.y, box.max.y), std::max(max.z, box.max.z)}};
+    }
+
     /**
      * Draw a bounding box with wires
      */
@@ -57,6 +165,15 @@ public:
      * Get collision information between ray and bounding box
      */
     RayCollision GetCollision(const ::Ray& ray) const { return GetRayCollisionBox(ray, *this); }
+
+    /**
+     * Get when moving the box by motion first touches another, as a fraction of the motion in the distance.
+     *
+     * @see raylib::SweptCollision
+     */
+    [[nodiscard]] RayCollision GetSweptCollision(::Vector3 motion, const ::BoundingBox& obstacle) const {
+        return SweptCollision::Sweep(*this, motion, obstacle);
+    }
 protected:
     void set(const ::BoundingBox& box) {
         min = box.min;
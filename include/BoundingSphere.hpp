@@ -0,0 +1,138 @@
+#ifndef RAYLIB_CPP_INCLUDE_BOUNDINGSPHERE_HPP_
+#define RAYLIB_CPP_INCLUDE_BOUNDINGSPHERE_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include "./BoundingBox.hpp"
+#include "./SweptCollision.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Sphere enclosing a set of points, for cheap visibility and overlap tests.
+ */
+class BoundingSphere {
+public:
+    BoundingSphere() = default;
+    BoundingSphere(::Vector3 center, float radius) : center(center), radius(radius) {}
+
+    /**
+     * Sphere around packed xyz positions, centered on their bounding box.
+     */
+    static BoundingSphere FromPoints(const float* points, size_t count) {
+        return FromPoints(points, count, BoundingBox::FromPoints(points, count));
+    }
+
+    /**
+     * Sphere around packed xyz positions, centered on the given box around them.
+     */
+    static BoundingSphere FromPoints(const float* points, size_t count, const ::BoundingBox& box) {
+        const ::Vector3 center{
+            (box.min.x + box.max.x) * 0.5f,
+            (box.min.y + box.max.y) * 0.5f,
+            (box.min.z + box.max.z) * 0.5f};
+
+        float radiusSquared = 0.0f;
+        if (points != nullptr) {
+            for (size_t i = 0; i < count; i++) {
+                const float x = points[i * 3] - center.x;
+                const float y = points[i * 3 + 1] - center.y;
+                const float z = points[i * 3 + 2] - center.z;
+                radiusSquared = std::max(radiusSquared, x * x + y * y + z * z);
+            }
+        }
+        return {center, std::sqrt(radiusSquared)};
+    }
+
+    GETTERSETTER(::Vector3, Center, center)
+    GETTERSETTER(float, Radius, radius)
+
+    /**
+     * Get the sphere after transforming it by the matrix, scaling the radius by the largest stretch of the matrix so
+     * it stays enclosing under any combination of rotations and non-uniform scales.
+     */
+    [[nodiscard]] BoundingSphere Transform(const ::Matrix& matrix) const {
+        const ::Vector3 transformed{
+            matrix.m0 * center.x + matrix.m4 * center.y + matrix.m8 * center.z + matrix.m12,
+            matrix.m1 * center.x + matrix.m5 * center.y + matrix.m9 * center.z + matrix.m13,
+            matrix.m2 * center.x + matrix.m6 * center.y + matrix.m10 * center.z + matrix.m14};
+        return {transformed, radius * std::sqrt(GetLargestStretchSquared(matrix))};
+    }
+
+    /**
+     * Detect collision between two spheres
+     */
+    [[nodiscard]] bool CheckCollision(const BoundingSphere& sphere) const {
+        return ::CheckCollisionSpheres(center, radius, sphere.center, sphere.radius);
+    }
+
+    /**
+     * Detect collision between sphere and box
+     */
+    [[nodiscard]] bool CheckCollision(const ::BoundingBox& box) const {
+        return ::CheckCollisionBoxSphere(box, center, radius);
+    }
+
+    /**
+     * Get when moving the sphere by motion first touches the box, as a fraction of the motion in the distance.
+     *
+     * @see raylib::SweptCollision
+     */
+    [[nodiscard]] RayCollision GetSweptCollision(::Vector3 motion, const ::BoundingBox& box) const {
+        return SweptCollision::Sweep(center, radius, motion, box);
+    }
+
+    /**
+     * Get when moving the sphere by motion first touches the triangle.
+     */
+    [[nodiscard]] RayCollision GetSweptCollision(::Vector3 motion, ::Vector3 p1, ::Vector3 p2, ::Vector3 p3) const {
+        return SweptCollision::Sweep(center, radius, motion, p1, p2, p3);
+    }
+
+    ::Vector3 center{0.0f, 0.0f, 0.0f};
+    float radius{0.0f};
+protected:
+    /**
+     * Largest eigenvalue of the symmetric matrix M^T M of the upper 3x3 part, in closed form.
+     */
+    static float GetLargestStretchSquared(const ::Matrix& m) {
+        const float columns[3][3] = {{m.m0, m.m1, m.m2}, {m.m4, m.m5, m.m6}, {m.m8, m.m9, m.m10}};
+        float a[3][3];
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                a[i][j] = columns[i][0] * columns[j][0] + columns[i][1] * columns[j][1] + columns[i][2] * columns[j][2];
+            }
+        }
+
+        const float offDiagonal = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+        const float q = (a[0][0] + a[1][1] + a[2][2]) / 3.0f;
+        const float d0 = a[0][0] - q;
+        const float d1 = a[1][1] - q;
+        const float d2 = a[2][2] - q;
+        const float p = std::sqrt((d0 * d0 + d1 * d1 + d2 * d2 + 2.0f * offDiagonal) / 6.0f);
+        if (p <= 0.0f) {
+            return q;
+        }
+
+        // Determinant of (A - qI) / p
+        const float b01 = a[0][1] / p;
+        const float b02 = a[0][2] / p;
+        const float b12 = a[1][2] / p;
+        const float b00 = d0 / p;
+        const float b11 = d1 / p;
+        const float b22 = d2 / p;
+        const float determinant = b00 * (b11 * b22 - b12 * b12) - b01 * (b01 * b22 - b12 * b02) +
+                                  b02 * (b01 * b12 - b11 * b02);
+        const float phi = std::acos(std::clamp(determinant * 0.5f, -1.0f, 1.0f)) / 3.0f;
+        // Small slack for rounding, so the sphere never ends up a hair too small
+        return (q + 2.0f * p * std::cos(phi)) * 1.0001f;
+    }
+};
+} // namespace raylib
+
+using RBoundingSphere = raylib::BoundingSphere;
+
+#endif // RAYLIB_CPP_INCLUDE_BOUNDINGSPHERE_HPP_
@@ -0,0 +1,95 @@
+#ifndef RAYLIB_CPP_INCLUDE_BROADPHASE_HPP_
+#define RAYLIB_CPP_INCLUDE_BROADPHASE_HPP_
+
+#include <algorithm>
+#include <type_traits>
+
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Bounds handling shared by the broad phase structures, i.e. SpatialHash and AABBTree, for 2D ::Rectangle or 3D
+ * ::BoundingBox bounds.
+ *
+ * Both are kept internally as a ::BoundingBox, rectangles lying at z = 0. Overlaps() agrees with
+ * ::CheckCollisionRecs() and ::CheckCollisionBoxes(), so the pairs found are those a pairwise loop would find.
+ */
+template<typename Bounds>
+struct BroadPhase {
+    static_assert(
+        std::is_same_v<Bounds, ::Rectangle> || std::is_same_v<Bounds, ::BoundingBox>,
+        "BroadPhase bounds are either a ::Rectangle or a ::BoundingBox");
+
+    static constexpr bool is2D = std::is_same_v<Bounds, ::Rectangle>;
+
+    static ::BoundingBox ToBox(const Bounds& bounds) {
+        if constexpr (is2D) {
+            return {{bounds.x, bounds.y, 0.0f}, {bounds.x + bounds.width, bounds.y + bounds.height, 0.0f}};
+        } else {
+            return bounds;
+        }
+    }
+
+    /**
+     * Exact test, open for rectangles and closed for boxes like raylib's own checks.
+     *
+     * Evaluates every axis without branching, as broad phase tests fail too unpredictably for early outs to pay.
+     */
+    static bool Overlaps(const ::BoundingBox& a, const ::BoundingBox& b) {
+        if constexpr (is2D) {
+            return (a.min.x < b.max.x) & (a.max.x > b.min.x) & (a.min.y < b.max.y) & (a.max.y > b.min.y);
+        } else {
+            return Touches(a, b);
+        }
+    }
+
+    /**
+     * Closed test, conservative for both kinds of bounds
+     */
+    static bool Touches(const ::BoundingBox& a, const ::BoundingBox& b) {
+        return (a.min.x <= b.max.x) & (a.max.x >= b.min.x) & (a.min.y <= b.max.y) & (a.max.y >= b.min.y) &
+               (a.min.z <= b.max.z) & (a.max.z >= b.min.z);
+    }
+
+    static bool Contains(const ::BoundingBox& outer, const ::BoundingBox& inner) {
+        return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+               outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+    }
+
+    static ::BoundingBox Union(const ::BoundingBox& a, const ::BoundingBox& b) {
+        return {
+            {std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z)},
+            {std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z)}};
+    }
+
+    /**
+     * Grow the box by the margin on every side, leaving rectangles flat.
+     */
+    static ::BoundingBox Expand(const ::BoundingBox& box, float margin) {
+        const float z = is2D ? 0.0f : margin;
+        return {
+            {box.min.x - margin, box.min.y - margin, box.min.z - z},
+            {box.max.x + margin, box.max.y + margin, box.max.z + z}};
+    }
+
+    /**
+     * Perimeter of a rectangle or surface area of a box, which is how likely a random query hits it
+     */
+    static float Cost(const ::BoundingBox& box) {
+        const float x = box.max.x - box.min.x;
+        const float y = box.max.y - box.min.y;
+        const float z = box.max.z - box.min.z;
+        if constexpr (is2D) {
+            return x + y;
+        } else {
+            return x * y + y * z + z * x;
+        }
+    }
+};
+} // namespace raylib
+
+template<typename Bounds>
+using RBroadPhase = raylib::BroadPhase<Bounds>;
+
+#endif // RAYLIB_CPP_INCLUDE_BROADPHASE_HPP_
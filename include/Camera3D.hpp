@@ -2,6 +2,7 @@
 #define RAYLIB_CPP_INCLUDE_CAMERA3D_HPP_
 
 #include "./raylib.hpp"
+#include "./Frustum.hpp"
 #include "./Vector2.hpp"
 #include "./Vector3.hpp"
 #include "./Matrix.hpp"
@@ -69,6 +70,13 @@ public:
      */
     Matrix GetMatrix() const { return ::GetCameraMatrix(*this); }
 
+    /**
+     * Get the view frustum for the aspect ratio of the render target, to cull what the camera cannot see.
+     */
+    Frustum GetFrustum(float aspect, float nearPlane = 0.01f, float farPlane = 1000.0f) const {
+        return Frustum(*this, aspect, nearPlane, farPlane);
+    }
+
     /**
      * Update camera position for selected mode
      */
@@ -0,0 +1,505 @@
+#ifndef RAYLIB_CPP_INCLUDE_COLLISIONBATCH_HPP_
+#define RAYLIB_CPP_INCLUDE_COLLISIONBATCH_HPP_
+
+#include <algorithm>
+#include <bit>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+#ifdef RAYLIB_CPP_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace raylib {
+/**
+ * Boxes and spheres stored by component, to test a ray or a box against all of them four at a time.
+ *
+ * Results are a mask with a bit per primitive, 32 to a word, and optionally the distance along the ray of each hit.
+ * Ray hits are at the same distances as ::GetRayCollisionBox() and ::GetRayCollisionSphere(), except that spheres
+ * behind the ray are missed.
+ *
+ * @code
+ * raylib::CollisionBatch targets;
+ * targets.AddSphere(enemy.position, enemy.radius);
+ * std::vector<uint32_t> hits(raylib::CollisionBatch::GetMaskSize(targets.GetSphereCount()));
+ * targets.GetRaySphereCollisions(bullet, hits, distances);
+ * @endcode
+ */
+class CollisionBatch {
+public:
+    CollisionBatch() = default;
+
+    explicit CollisionBatch(std::span<const ::BoundingBox> boxes) {
+        for (const ::BoundingBox& box : boxes) {
+            AddBox(box);
+        }
+    }
+
+    /**
+     * @return The index of the box.
+     */
+    size_t AddBox(const ::BoundingBox& box) {
+        boxes.resize(boxes.size() + 1);
+        SetBox(boxes.size() - 1, box);
+        return boxes.size() - 1;
+    }
+
+    void SetBox(size_t index, const ::BoundingBox& box) {
+        boxes.minX[index] = box.min.x;
+        boxes.minY[index] = box.min.y;
+        boxes.minZ[index] = box.min.z;
+        boxes.maxX[index] = box.max.x;
+        boxes.maxY[index] = box.max.y;
+        boxes.maxZ[index] = box.max.z;
+    }
+
+    [[nodiscard]] ::BoundingBox GetBox(size_t index) const {
+        return {
+            {boxes.minX[index], boxes.minY[index], boxes.minZ[index]},
+            {boxes.maxX[index], boxes.maxY[index], boxes.maxZ[index]}};
+    }
+
+    [[nodiscard]] size_t GetBoxCount() const { return boxes.size(); }
+
+    /**
+     * @return The index of the sphere.
+     */
+    size_t AddSphere(::Vector3 center, float radius) {
+        spheres.resize(spheres.size() + 1);
+        SetSphere(spheres.size() - 1, center, radius);
+        return spheres.size() - 1;
+    }
+
+    void SetSphere(size_t index, ::Vector3 center, float radius) {
+        spheres.x[index] = center.x;
+        spheres.y[index] = center.y;
+        spheres.z[index] = center.z;
+        spheres.radius[index] = radius;
+    }
+
+    [[nodiscard]] ::Vector3 GetSphereCenter(size_t index) const {
+        return {spheres.x[index], spheres.y[index], spheres.z[index]};
+    }
+
+    [[nodiscard]] float GetSphereRadius(size_t index) const { return spheres.radius[index]; }
+
+    [[nodiscard]] size_t GetSphereCount() const { return spheres.size(); }
+
+    void Clear() {
+        boxes.resize(0);
+        spheres.resize(0);
+    }
+
+    /**
+     * Test the ray against every box.
+     *
+     * @param mask Receives a bit per box, GetMaskSize() words.
+     * @param distances Receives the distance of each hit and FLT_MAX for misses, if not empty.
+     * @return The number of boxes hit.
+     * @throws raylib::RaylibException Throws if the mask or the distances are too small.
+     */
+    size_t GetRayBoxCollisions(
+        const ::Ray& ray,
+        std::span<uint32_t> mask,
+        std::span<float> distances = {},
+        float maxDistance = FLT_MAX) const {
+        const size_t count = boxes.size();
+        Prepare(mask, distances, count);
+        const ::Vector3 inverse{1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z};
+        size_t i = 0;
+#ifdef RAYLIB_CPP_SSE2
+        const __m128 px = _mm_set1_ps(ray.position.x);
+        const __m128 py = _mm_set1_ps(ray.position.y);
+        const __m128 pz = _mm_set1_ps(ray.position.z);
+        const __m128 ix = _mm_set1_ps(inverse.x);
+        const __m128 iy = _mm_set1_ps(inverse.y);
+        const __m128 iz = _mm_set1_ps(inverse.z);
+        const __m128 limit = _mm_set1_ps(maxDistance);
+        for (; i + 4 <= count; i += 4) {
+            __m128 distance;
+            const __m128 hit = Slab(
+                _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&boxes.minX[i]), px), ix),
+                _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&boxes.maxX[i]), px), ix),
+                _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&boxes.minY[i]), py), iy),
+                _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&boxes.maxY[i]), py), iy),
+                _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&boxes.minZ[i]), pz), iz),
+                _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&boxes.maxZ[i]), pz), iz),
+                limit,
+                distance);
+            Store(mask, distances, i, hit, distance);
+        }
+#endif
+        for (; i < count; i++) {
+            float distance = FLT_MAX;
+            const bool hit = Slab(
+                (boxes.minX[i] - ray.position.x) * inverse.x,
+                (boxes.maxX[i] - ray.position.x) * inverse.x,
+                (boxes.minY[i] - ray.position.y) * inverse.y,
+                (boxes.maxY[i] - ray.position.y) * inverse.y,
+                (boxes.minZ[i] - ray.position.z) * inverse.z,
+                (boxes.maxZ[i] - ray.position.z) * inverse.z,
+                maxDistance,
+                distance);
+            Store(mask, distances, i, hit, distance);
+        }
+        return CountHits(mask, count);
+    }
+
+    /**
+     * Test the ray against every sphere.
+     *
+     * @param mask Receives a bit per sphere, GetMaskSize() words.
+     * @param distances Receives the distance of each hit and FLT_MAX for misses, if not empty.
+     * @return The number of spheres hit.
+     * @throws raylib::RaylibException Throws if the mask or the distances are too small.
+     */
+    size_t GetRaySphereCollisions(
+        const ::Ray& ray,
+        std::span<uint32_t> mask,
+        std::span<float> distances = {},
+        float maxDistance = FLT_MAX) const {
+        const size_t count = spheres.size();
+        Prepare(mask, distances, count);
+        const ::Vector3 d = ray.direction;
+        const float a = d.x * d.x + d.y * d.y + d.z * d.z;
+        if (!(a > 0.0f)) {
+            if (!distances.empty()) {
+                std::fill_n(distances.begin(), count, FLT_MAX);
+            }
+            return 0;
+        }
+        const float inverseA = 1.0f / a;
+        size_t i = 0;
+#ifdef RAYLIB_CPP_SSE2
+        const __m128 px = _mm_set1_ps(ray.position.x);
+        const __m128 py = _mm_set1_ps(ray.position.y);
+        const __m128 pz = _mm_set1_ps(ray.position.z);
+        const __m128 dx = _mm_set1_ps(d.x);
+        const __m128 dy = _mm_set1_ps(d.y);
+        const __m128 dz = _mm_set1_ps(d.z);
+        const __m128 as = _mm_set1_ps(a);
+        const __m128 inverseAs = _mm_set1_ps(inverseA);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 limit = _mm_set1_ps(maxDistance);
+        for (; i + 4 <= count; i += 4) {
+            const __m128 ox = _mm_sub_ps(_mm_loadu_ps(&spheres.x[i]), px);
+            const __m128 oy = _mm_sub_ps(_mm_loadu_ps(&spheres.y[i]), py);
+            const __m128 oz = _mm_sub_ps(_mm_loadu_ps(&spheres.z[i]), pz);
+            const __m128 r = _mm_loadu_ps(&spheres.radius[i]);
+            const __m128 b = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ox, dx), _mm_mul_ps(oy, dy)), _mm_mul_ps(oz, dz));
+            const __m128 c = _mm_sub_ps(
+                _mm_add_ps(_mm_add_ps(_mm_mul_ps(ox, ox), _mm_mul_ps(oy, oy)), _mm_mul_ps(oz, oz)),
+                _mm_mul_ps(r, r));
+            const __m128 discriminant = _mm_sub_ps(_mm_mul_ps(b, b), _mm_mul_ps(as, c));
+            const __m128 root = _mm_sqrt_ps(_mm_max_ps(discriminant, zero));
+            const __m128 nearT = _mm_mul_ps(_mm_sub_ps(b, root), inverseAs);
+            const __m128 farT = _mm_mul_ps(_mm_add_ps(b, root), inverseAs);
+            // From inside the sphere the hit is where the ray leaves it
+            const __m128 behind = _mm_cmplt_ps(nearT, zero);
+            const __m128 distance = _mm_or_ps(_mm_and_ps(behind, farT), _mm_andnot_ps(behind, nearT));
+            const __m128 hit = _mm_and_ps(
+                _mm_cmpge_ps(discriminant, zero),
+                _mm_and_ps(_mm_cmpge_ps(distance, zero), _mm_cmple_ps(distance, limit)));
+            Store(mask, distances, i, hit, distance);
+        }
+#endif
+        for (; i < count; i++) {
+            const float ox = spheres.x[i] - ray.position.x;
+            const float oy = spheres.y[i] - ray.position.y;
+            const float oz = spheres.z[i] - ray.position.z;
+            const float r = spheres.radius[i];
+            const float b = ox * d.x + oy * d.y + oz * d.z;
+            const float c = (ox * ox + oy * oy + oz * oz) - r * r;
+            const float discriminant = b * b - a * c;
+            const float root = std::sqrt(std::max(discriminant, 0.0f));
+            const float nearT = (b - root) * inverseA;
+            const float distance = nearT < 0.0f ? (b + root) * inverseA : nearT;
+            Store(mask, distances, i, discriminant >= 0.0f && distance >= 0.0f && distance <= maxDistance, distance);
+        }
+        return CountHits(mask, count);
+    }
+
+    /**
+     * Test the box against every box, like ::CheckCollisionBoxes().
+     *
+     * @param mask Receives a bit per box, GetMaskSize() words.
+     * @return The number of boxes overlapping.
+     * @throws raylib::RaylibException Throws if the mask is too small.
+     */
+    size_t CheckBoxCollisions(const ::BoundingBox& box, std::span<uint32_t> mask) const {
+        const size_t count = boxes.size();
+        Prepare(mask, {}, count);
+        size_t i = 0;
+#ifdef RAYLIB_CPP_SSE2
+        const __m128 minX = _mm_set1_ps(box.min.x);
+        const __m128 minY = _mm_set1_ps(box.min.y);
+        const __m128 minZ = _mm_set1_ps(box.min.z);
+        const __m128 maxX = _mm_set1_ps(box.max.x);
+        const __m128 maxY = _mm_set1_ps(box.max.y);
+        const __m128 maxZ = _mm_set1_ps(box.max.z);
+        for (; i + 4 <= count; i += 4) {
+            const __m128 x = _mm_and_ps(
+                _mm_cmple_ps(_mm_loadu_ps(&boxes.minX[i]), maxX),
+                _mm_cmpge_ps(_mm_loadu_ps(&boxes.maxX[i]), minX));
+            const __m128 y = _mm_and_ps(
+                _mm_cmple_ps(_mm_loadu_ps(&boxes.minY[i]), maxY),
+                _mm_cmpge_ps(_mm_loadu_ps(&boxes.maxY[i]), minY));
+            const __m128 z = _mm_and_ps(
+                _mm_cmple_ps(_mm_loadu_ps(&boxes.minZ[i]), maxZ),
+                _mm_cmpge_ps(_mm_loadu_ps(&boxes.maxZ[i]), minZ));
+            const __m128 hit = _mm_and_ps(_mm_and_ps(x, y), z);
+            Store(mask, {}, i, hit, hit);
+        }
+#endif
+        for (; i < count; i++) {
+            const bool hit = boxes.minX[i] <= box.max.x && boxes.maxX[i] >= box.min.x && boxes.minY[i] <= box.max.y &&
+                             boxes.maxY[i] >= box.min.y && boxes.minZ[i] <= box.max.z && boxes.maxZ[i] >= box.min.z;
+            Store(mask, {}, i, hit, 0.0f);
+        }
+        return CountHits(mask, count);
+    }
+
+    /**
+     * Test the box against every sphere, like ::CheckCollisionBoxSphere().
+     *
+     * @param mask Receives a bit per sphere, GetMaskSize() words.
+     * @return The number of spheres overlapping.
+     * @throws raylib::RaylibException Throws if the mask is too small.
+     */
+    size_t CheckBoxSphereCollisions(const ::BoundingBox& box, std::span<uint32_t> mask) const {
+        const size_t count = spheres.size();
+        Prepare(mask, {}, count);
+        size_t i = 0;
+#ifdef RAYLIB_CPP_SSE2
+        const __m128 minX = _mm_set1_ps(box.min.x);
+        const __m128 minY = _mm_set1_ps(box.min.y);
+        const __m128 minZ = _mm_set1_ps(box.min.z);
+        const __m128 maxX = _mm_set1_ps(box.max.x);
+        const __m128 maxY = _mm_set1_ps(box.max.y);
+        const __m128 maxZ = _mm_set1_ps(box.max.z);
+        const __m128 zero = _mm_setzero_ps();
+        for (; i + 4 <= count; i += 4) {
+            // Distance from the center to the closest point of the box, per axis
+            const __m128 x = _mm_loadu_ps(&spheres.x[i]);
+            const __m128 y = _mm_loadu_ps(&spheres.y[i]);
+            const __m128 z = _mm_loadu_ps(&spheres.z[i]);
+            const __m128 r = _mm_loadu_ps(&spheres.radius[i]);
+            const __m128 ax = _mm_max_ps(_mm_max_ps(_mm_sub_ps(minX, x), _mm_sub_ps(x, maxX)), zero);
+            const __m128 ay = _mm_max_ps(_mm_max_ps(_mm_sub_ps(minY, y), _mm_sub_ps(y, maxY)), zero);
+            const __m128 az = _mm_max_ps(_mm_max_ps(_mm_sub_ps(minZ, z), _mm_sub_ps(z, maxZ)), zero);
+            const __m128 squared =
+                _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, ax), _mm_mul_ps(ay, ay)), _mm_mul_ps(az, az));
+            const __m128 hit = _mm_cmple_ps(squared, _mm_mul_ps(r, r));
+            Store(mask, {}, i, hit, hit);
+        }
+#endif
+        for (; i < count; i++) {
+            const float ax = std::max({box.min.x - spheres.x[i], spheres.x[i] - box.max.x, 0.0f});
+            const float ay = std::max({box.min.y - spheres.y[i], spheres.y[i] - box.max.y, 0.0f});
+            const float az = std::max({box.min.z - spheres.z[i], spheres.z[i] - box.max.z, 0.0f});
+            Store(mask, {}, i, ax * ax + ay * ay + az * az <= spheres.radius[i] * spheres.radius[i], 0.0f);
+        }
+        return CountHits(mask, count);
+    }
+
+    /**
+     * Test every ray against the box.
+     *
+     * @param mask Receives a bit per ray, GetMaskSize() words.
+     * @param distances Receives the distance of each hit and FLT_MAX for misses, if not empty.
+     * @return The number of rays hitting the box.
+     * @throws raylib::RaylibException Throws if the mask or the distances are too small.
+     */
+    static size_t GetRayCollisions(
+        std::span<const ::Ray> rays,
+        const ::BoundingBox& box,
+        std::span<uint32_t> mask,
+        std::span<float> distances = {},
+        float maxDistance = FLT_MAX) {
+        const size_t count = rays.size();
+        Prepare(mask, distances, count);
+        size_t i = 0;
+#ifdef RAYLIB_CPP_SSE2
+        const __m128 minX = _mm_set1_ps(box.min.x);
+        const __m128 minY = _mm_set1_ps(box.min.y);
+        const __m128 minZ = _mm_set1_ps(box.min.z);
+        const __m128 maxX = _mm_set1_ps(box.max.x);
+        const __m128 maxY = _mm_set1_ps(box.max.y);
+        const __m128 maxZ = _mm_set1_ps(box.max.z);
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 limit = _mm_set1_ps(maxDistance);
+        for (; i + 4 <= count; i += 4) {
+            const ::Ray* r = rays.data() + i;
+            const __m128 px = _mm_setr_ps(r[0].position.x, r[1].position.x, r[2].position.x, r[3].position.x);
+            const __m128 py = _mm_setr_ps(r[0].position.y, r[1].position.y, r[2].position.y, r[3].position.y);
+            const __m128 pz = _mm_setr_ps(r[0].position.z, r[1].position.z, r[2].position.z, r[3].position.z);
+            const __m128 ix = _mm_div_ps(
+                one,
+                _mm_setr_ps(r[0].direction.x, r[1].direction.x, r[2].direction.x, r[3].direction.x));
+            const __m128 iy = _mm_div_ps(
+                one,
+                _mm_setr_ps(r[0].direction.y, r[1].direction.y, r[2].direction.y, r[3].direction.y));
+            const __m128 iz = _mm_div_ps(
+                one,
+                _mm_setr_ps(r[0].direction.z, r[1].direction.z, r[2].direction.z, r[3].direction.z));
+            __m128 distance;
+            const __m128 hit = Slab(
+                _mm_mul_ps(_mm_sub_ps(minX, px), ix),
+                _mm_mul_ps(_mm_sub_ps(maxX, px), ix),
+                _mm_mul_ps(_mm_sub_ps(minY, py), iy),
+                _mm_mul_ps(_mm_sub_ps(maxY, py), iy),
+                _mm_mul_ps(_mm_sub_ps(minZ, pz), iz),
+                _mm_mul_ps(_mm_sub_ps(maxZ, pz), iz),
+                limit,
+                distance);
+            Store(mask, distances, i, hit, distance);
+        }
+#endif
+        for (; i < count; i++) {
+            const ::Ray& ray = rays[i];
+            const ::Vector3 inverse{1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z};
+            float distance = FLT_MAX;
+            const bool hit = Slab(
+                (box.min.x - ray.position.x) * inverse.x,
+                (box.max.x - ray.position.x) * inverse.x,
+                (box.min.y - ray.position.y) * inverse.y,
+                (box.max.y - ray.position.y) * inverse.y,
+                (box.min.z - ray.position.z) * inverse.z,
+                (box.max.z - ray.position.z) * inverse.z,
+                maxDistance,
+                distance);
+            Store(mask, distances, i, hit, distance);
+        }
+        return CountHits(mask, count);
+    }
+
+    /**
+     * Words of a mask for the number of primitives
+     */
+    static constexpr size_t GetMaskSize(size_t count) { return (count + 31) / 32; }
+
+    /**
+     * Whether the primitive's bit is set in the mask
+     */
+    static bool IsHit(std::span<const uint32_t> mask, size_t index) {
+        return ((mask[index / 32] >> (index % 32)) & 1u) != 0;
+    }
+protected:
+    struct Boxes {
+        std::vector<float> minX{};
+        std::vector<float> minY{};
+        std::vector<float> minZ{};
+        std::vector<float> maxX{};
+        std::vector<float> maxY{};
+        std::vector<float> maxZ{};
+
+        [[nodiscard]] size_t size() const { return minX.size(); }
+
+        void resize(size_t count) {
+            for (std::vector<float>* component : {&minX, &minY, &minZ, &maxX, &maxY, &maxZ}) {
+                component->resize(count);
+            }
+        }
+    };
+
+    struct Spheres {
+        std::vector<float> x{};
+        std::vector<float> y{};
+        std::vector<float> z{};
+        std::vector<float> radius{};
+
+        [[nodiscard]] size_t size() const { return x.size(); }
+
+        void resize(size_t count) {
+            for (std::vector<float>* component : {&x, &y, &z, &radius}) {
+                component->resize(count);
+            }
+        }
+    };
+
+    static void Prepare(std::span<uint32_t> mask, std::span<float> distances, size_t count) {
+        if (mask.size() < GetMaskSize(count)) {
+            throw RaylibException("CollisionBatch mask is too small");
+        }
+        if (!distances.empty() && distances.size() < count) {
+            throw RaylibException("CollisionBatch distances are too few");
+        }
+        std::fill_n(mask.begin(), GetMaskSize(count), 0u);
+    }
+
+    static size_t CountHits(std::span<const uint32_t> mask, size_t count) {
+        size_t hits = 0;
+        for (size_t word = 0; word < GetMaskSize(count); word++) {
+            hits += static_cast<size_t>(std::popcount(mask[word]));
+        }
+        return hits;
+    }
+
+    /**
+     * Entry and exit of the ray from the distances to the planes of each axis.
+     *
+     * The distance is where the ray enters the box, or leaves it when starting inside.
+     */
+    static bool Slab(float x1, float x2, float y1, float y2, float z1, float z2, float limit, float& distance) {
+        const float enter = std::max({std::min(x1, x2), std::min(y1, y2), std::min(z1, z2)});
+        const float exit = std::min({std::max(x1, x2), std::max(y1, y2), std::max(z1, z2)});
+        distance = enter < 0.0f ? exit : enter;
+        return exit >= 0.0f && enter <= exit && distance <= limit;
+    }
+
+    static void Store(std::span<uint32_t> mask, std::span<float> distances, size_t index, bool hit, float distance) {
+        if (hit) {
+            mask[index / 32] |= 1u << (index % 32);
+        }
+        if (!distances.empty()) {
+            distances[index] = hit ? distance : FLT_MAX;
+        }
+    }
+
+#ifdef RAYLIB_CPP_SSE2
+    static __m128 Slab(
+        __m128 x1,
+        __m128 x2,
+        __m128 y1,
+        __m128 y2,
+        __m128 z1,
+        __m128 z2,
+        __m128 limit,
+        __m128& distance) {
+        const __m128 enter = _mm_max_ps(_mm_max_ps(_mm_min_ps(x1, x2), _mm_min_ps(y1, y2)), _mm_min_ps(z1, z2));
+        const __m128 exit = _mm_min_ps(_mm_min_ps(_mm_max_ps(x1, x2), _mm_max_ps(y1, y2)), _mm_max_ps(z1, z2));
+        const __m128 inside = _mm_cmplt_ps(enter, _mm_setzero_ps());
+        distance = _mm_or_ps(_mm_and_ps(inside, exit), _mm_andnot_ps(inside, enter));
+        return _mm_and_ps(
+            _mm_and_ps(_mm_cmpge_ps(exit, _mm_setzero_ps()), _mm_cmple_ps(enter, exit)),
+            _mm_cmple_ps(distance, limit));
+    }
+
+    /**
+     * Store four results, index being a multiple of four so they share a mask word.
+     */
+    static void Store(std::span<uint32_t> mask, std::span<float> distances, size_t index, __m128 hit, __m128 distance) {
+        mask[index / 32] |= static_cast<uint32_t>(_mm_movemask_ps(hit)) << (index % 32);
+        if (!distances.empty()) {
+            const __m128 misses = _mm_andnot_ps(hit, _mm_set1_ps(FLT_MAX));
+            _mm_storeu_ps(&distances[index], _mm_or_ps(_mm_and_ps(hit, distance), misses));
+        }
+    }
+#endif
+
+    Boxes boxes{};
+    Spheres spheres{};
+};
+} // namespace raylib
+
+using RCollisionBatch = raylib::CollisionBatch;
+
+#endif // RAYLIB_CPP_INCLUDE_COLLISIONBATCH_HPP_
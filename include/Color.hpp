@@ -4,6 +4,8 @@
 #include <string>
 #include <string_view>
 
+#include "./ColorSpace.hpp"
+#include "./Vector3.hpp"
 #include "./Vector4.hpp"
 #include "./RadiansDegrees.hpp"
 #include "./raylib-cpp-utils.hpp"
@@ -15,42 +17,63 @@ namespace raylib {
  */
 class Color : public ::Color {
 public:
-    Color(const ::Color& color) : ::Color{color.r, color.g, color.b, color.a} {}
+    constexpr Color(const ::Color& color) : ::Color{color.r, color.g, color.b, color.a} {}
 
-    Color(unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha = 255)
+    constexpr Color(unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha = 255)
         : ::Color{red, green, blue, alpha} {};
 
     /**
      * Black.
      */
-    Color() : ::Color{0, 0, 0, 255} {};
+    constexpr Color() : ::Color{0, 0, 0, 255} {};
 
     /**
      * Returns a Color from HSV values
      */
-    Color(::Vector3 hsv) { set(::ColorFromHSV(hsv.x, hsv.y, hsv.z)); }
+    constexpr Color(::Vector3 hsv) : Color(FromHSV(hsv.x, hsv.y, hsv.z)) {}
 
     /**
      * Returns a Color from HSV values
+     *
+     * @see ::ColorFromHSV()
      */
-    static ::Color FromHSV(float hue, float saturation, float value) { return ::ColorFromHSV(hue, saturation, value); }
+    static constexpr Color FromHSV(float hue, float saturation, float value) {
+        return {
+            HSVChannel(5.0f, hue, saturation, value),
+            HSVChannel(3.0f, hue, saturation, value),
+            HSVChannel(1.0f, hue, saturation, value),
+            255};
+    }
 
     /**
-     * Get Color structure from hexadecimal value
+     * Get Color structure from hexadecimal value (0xRRGGBBAA)
+     *
+     * @see ::GetColor()
      */
-    explicit Color(unsigned int hexValue) : ::Color(::GetColor(hexValue)) { }
+    constexpr explicit Color(unsigned int hexValue)
+        : ::Color{
+            static_cast<unsigned char>((hexValue >> 24) & 0xFF),
+            static_cast<unsigned char>((hexValue >> 16) & 0xFF),
+            static_cast<unsigned char>((hexValue >> 8) & 0xFF),
+            static_cast<unsigned char>(hexValue & 0xFF)} { }
 
     Color(void* srcPtr, int format) : ::Color(::GetPixelColor(srcPtr, format)) { }
 
     /**
      * Returns hexadecimal value for a Color
      */
-    [[nodiscard]] int ToInt() const { return ::ColorToInt(*this); }
+    [[nodiscard]] constexpr int ToInt() const {
+        return static_cast<int>(
+            (static_cast<unsigned int>(r) << 24) |
+            (static_cast<unsigned int>(g) << 16) |
+            (static_cast<unsigned int>(b) << 8) |
+            static_cast<unsigned int>(a));
+    }
 
     /**
      * Returns hexadecimal value for a Color
      */
-    explicit operator int() const { return ::ColorToInt(*this); }
+    constexpr explicit operator int() const { return ToInt(); }
 
     [[nodiscard]] std::string ToString() const { return TextFormat("Color(%d, %d, %d, %d)", r, g, b, a); }
 
@@ -59,22 +82,65 @@ public:
     /**
      * Returns color with alpha applied, alpha goes from 0.0f to 1.0f
      */
-    [[nodiscard]] Color Fade(float alpha) const { return ::Fade(*this, alpha); }
+    [[nodiscard]] constexpr Color Fade(float alpha) const { return Alpha(alpha); }
 
     /**
      * Returns Color normalized as float [0..1]
      */
-    [[nodiscard]] Vector4 Normalize() const { return ::ColorNormalize(*this); }
+    [[nodiscard]] constexpr Vector4 Normalize() const {
+        return {
+            static_cast<float>(r) / 255.0f,
+            static_cast<float>(g) / 255.0f,
+            static_cast<float>(b) / 255.0f,
+            static_cast<float>(a) / 255.0f};
+    }
 
     /**
      * Returns Color from normalized values [0..1]
      */
-    explicit Color(::Vector4 normalized) : Color(::ColorFromNormalized(normalized)) { }
+    constexpr explicit Color(::Vector4 normalized)
+        : ::Color{
+            static_cast<unsigned char>(normalized.x * 255.0f),
+            static_cast<unsigned char>(normalized.y * 255.0f),
+            static_cast<unsigned char>(normalized.z * 255.0f),
+            static_cast<unsigned char>(normalized.w * 255.0f)} { }
 
     /**
      * Returns HSV values for a Color
+     *
+     * @see ::ColorToHSV()
      */
-    [[nodiscard]] Vector3 ToHSV() const { return ::ColorToHSV(*this); }
+    [[nodiscard]] constexpr Vector3 ToHSV() const {
+        const float red = static_cast<float>(r) / 255.0f;
+        const float green = static_cast<float>(g) / 255.0f;
+        const float blue = static_cast<float>(b) / 255.0f;
+
+        float min = red < green ? red : green;
+        min = min < blue ? min : blue;
+        float max = red > green ? red : green;
+        max = max > blue ? max : blue;
+
+        const float delta = max - min;
+        if (delta < 0.00001f || max <= 0.0f) {
+            return {0.0f, 0.0f, max};
+        }
+
+        float hue = 0.0f;
+        if (red >= max) {
+            hue = (green - blue) / delta;
+        } else if (green >= max) {
+            hue = 2.0f + (blue - red) / delta;
+        } else {
+            hue = 4.0f + (red - green) / delta;
+        }
+
+        hue *= 60.0f;
+        if (hue < 0.0f) {
+            hue += 360.0f;
+        }
+
+        return {hue, delta / max, max};
+    }
 
     GETTERSETTER(unsigned char, R, r)
     GETTERSETTER(unsigned char, G, g)
@@ -187,8 +253,10 @@ public:
         return ::ColorIsEqual(*this, color);
     }
 
-    bool operator==(const ::Color& other) const { return ::ColorIsEqual(*this, other); }
-    bool operator!=(const ::Color& other) const { return !::ColorIsEqual(*this, other); }
+    constexpr bool operator==(const ::Color& other) const {
+        return r == other.r && g == other.g && b == other.b && a == other.a;
+    }
+    constexpr bool operator!=(const ::Color& other) const { return !(*this == other); }
 
     /**
      * Get color multiplied with another color
@@ -208,10 +276,21 @@ public:
     /**
      * Returns color with alpha applied, alpha goes from 0.0f to 1.0f
      */
-    [[nodiscard]] Color Alpha(float alpha) const { return ::ColorAlpha(*this, alpha); }
+    [[nodiscard]] constexpr Color Alpha(float alpha) const {
+        alpha = alpha < 0.0f ? 0.0f : (alpha > 1.0f ? 1.0f : alpha);
+        return {r, g, b, static_cast<unsigned char>(255.0f * alpha)};
+    }
 
-    Color Lerp(::Color color2, float factor) {
-        return ::ColorLerp(*this, color2, factor);
+    /**
+     * Get color lerp interpolation between two colors, factor [0.0f..1.0f]
+     */
+    [[nodiscard]] constexpr Color Lerp(::Color color2, float factor) const {
+        factor = factor < 0.0f ? 0.0f : (factor > 1.0f ? 1.0f : factor);
+        return {
+            LerpChannel(r, color2.r, factor),
+            LerpChannel(g, color2.g, factor),
+            LerpChannel(b, color2.b, factor),
+            LerpChannel(a, color2.a, factor)};
     }
 
     /**
@@ -219,32 +298,77 @@ public:
      */
     [[nodiscard]] Color AlphaBlend(::Color dst, ::Color tint) const { return ::ColorAlphaBlend(dst, *this, tint); }
 
-    static Color LightGray() { return LIGHTGRAY; }
-    static Color Gray() { return GRAY; }
-    static Color DarkGray() { return DARKGRAY; }
-    static Color Yellow() { return YELLOW; }
-    static Color Gold() { return GOLD; }
-    static Color Orange() { return ORANGE; }
-    static Color Pink() { return PINK; }
-    static Color Red() { return RED; }
-    static Color Maroon() { return MAROON; }
-    static Color Green() { return GREEN; }
-    static Color Lime() { return LIME; }
-    static Color DarkGreen() { return DARKGREEN; }
-    static Color SkyBlue() { return SKYBLUE; }
-    static Color Blue() { return BLUE; }
-    static Color DarkBlue() { return DARKBLUE; }
-    static Color Purple() { return PURPLE; }
-    static Color Violet() { return VIOLET; }
-    static Color DarkPurple() { return DARKPURPLE; }
-    static Color Beige() { return BEIGE; }
-    static Color Brown() { return BROWN; }
-    static Color DarkBrown() { return DARKBROWN; }
-    static Color White() { return WHITE; }
-    static Color Black() { return BLACK; }
-    static Color Blank() { return BLANK; }
-    static Color Magenta() { return MAGENTA; }
-    static Color RayWhite() { return RAYWHITE; }
+    /**
+     * Returns the color as linear light RGB and linear alpha, all [0.0f..1.0f]
+     */
+    [[nodiscard]] Vector4 ToLinear() const { return ColorSpace::ToLinear(*this); }
+
+    /**
+     * Returns a Color from linear light RGB and linear alpha, all [0.0f..1.0f]
+     */
+    static Color FromLinear(::Vector4 linear) { return ColorSpace::FromLinear(linear); }
+
+    /**
+     * Get color lerp interpolation between two colors in linear light, factor [0.0f..1.0f]
+     */
+    [[nodiscard]] Color LerpGammaCorrect(::Color color2, float factor) const {
+        factor = factor < 0.0f ? 0.0f : (factor > 1.0f ? 1.0f : factor);
+        const ::Vector4 from = ColorSpace::ToLinear(*this);
+        const ::Vector4 to = ColorSpace::ToLinear(color2);
+        return ColorSpace::FromLinear({
+            from.x + (to.x - from.x) * factor,
+            from.y + (to.y - from.y) * factor,
+            from.z + (to.z - from.z) * factor,
+            from.w + (to.w - from.w) * factor});
+    }
+
+    /**
+     * Returns src alpha-blended into dst color with tint, blending in linear light
+     */
+    [[nodiscard]] Color AlphaBlendGammaCorrect(::Color dst, ::Color tint) const {
+        const ::Vector4 t = ColorSpace::ToLinear(tint);
+        ::Vector4 src = ColorSpace::ToLinear(*this);
+        src = {src.x * t.x, src.y * t.y, src.z * t.z, src.w * t.w};
+        const ::Vector4 d = ColorSpace::ToLinear(dst);
+
+        const float alpha = src.w + d.w * (1.0f - src.w);
+        if (alpha <= 0.0f) {
+            return {0, 0, 0, 0};
+        }
+        const float dstWeight = d.w * (1.0f - src.w);
+        return ColorSpace::FromLinear({
+            (src.x * src.w + d.x * dstWeight) / alpha,
+            (src.y * src.w + d.y * dstWeight) / alpha,
+            (src.z * src.w + d.z * dstWeight) / alpha,
+            alpha});
+    }
+
+    static constexpr Color LightGray() { return {200, 200, 200, 255}; }
+    static constexpr Color Gray() { return {130, 130, 130, 255}; }
+    static constexpr Color DarkGray() { return {80, 80, 80, 255}; }
+    static constexpr Color Yellow() { return {253, 249, 0, 255}; }
+    static constexpr Color Gold() { return {255, 203, 0, 255}; }
+    static constexpr Color Orange() { return {255, 161, 0, 255}; }
+    static constexpr Color Pink() { return {255, 109, 194, 255}; }
+    static constexpr Color Red() { return {230, 41, 55, 255}; }
+    static constexpr Color Maroon() { return {190, 33, 55, 255}; }
+    static constexpr Color Green() { return {0, 228, 48, 255}; }
+    static constexpr Color Lime() { return {0, 158, 47, 255}; }
+    static constexpr Color DarkGreen() { return {0, 117, 44, 255}; }
+    static constexpr Color SkyBlue() { return {102, 191, 255, 255}; }
+    static constexpr Color Blue() { return {0, 121, 241, 255}; }
+    static constexpr Color DarkBlue() { return {0, 82, 172, 255}; }
+    static constexpr Color Purple() { return {200, 122, 255, 255}; }
+    static constexpr Color Violet() { return {135, 60, 190, 255}; }
+    static constexpr Color DarkPurple() { return {112, 31, 126, 255}; }
+    static constexpr Color Beige() { return {211, 176, 131, 255}; }
+    static constexpr Color Brown() { return {127, 106, 79, 255}; }
+    static constexpr Color DarkBrown() { return {76, 63, 47, 255}; }
+    static constexpr Color White() { return {255, 255, 255, 255}; }
+    static constexpr Color Black() { return {0, 0, 0, 255}; }
+    static constexpr Color Blank() { return {0, 0, 0, 0}; }
+    static constexpr Color Magenta() { return {255, 0, 255, 255}; }
+    static constexpr Color RayWhite() { return {245, 245, 245, 255}; }
 protected:
     void set(const ::Color& color) {
         r = color.r;
@@ -252,8 +376,35 @@ protected:
         b = color.b;
         a = color.a;
     }
+
+    /**
+     * Computes one RGB channel of ::ColorFromHSV(), where offset is 5 for red, 3 for green and 1 for blue.
+     */
+    static constexpr unsigned char HSVChannel(float offset, float hue, float saturation, float value) {
+        // fmodf() is not constexpr, truncate towards zero the same way it does.
+        float k = offset + hue / 60.0f;
+        k -= static_cast<float>(static_cast<long long>(k / 6.0f)) * 6.0f;
+        const float t = 4.0f - k;
+        k = (t < k) ? t : k;
+        k = (k < 1.0f) ? k : 1.0f;
+        k = (k > 0.0f) ? k : 0.0f;
+        return static_cast<unsigned char>((value - value * saturation * k) * 255.0f);
+    }
+
+    static constexpr unsigned char LerpChannel(unsigned char from, unsigned char to, float factor) {
+        return static_cast<unsigned char>((1.0f - factor) * static_cast<float>(from) + factor * static_cast<float>(to));
+    }
 };
 
+inline namespace literals {
+/**
+ * Color from a 0xRRGGBBAA hexadecimal literal, i.e. `0xE62937FF_rgba`.
+ */
+constexpr Color operator""_rgba(unsigned long long hexValue) {
+    return Color(static_cast<unsigned int>(hexValue));
+}
+} // namespace literals
+
 } // namespace raylib
 
 using RColor = raylib::Color;
@@ -0,0 +1,150 @@
+#ifndef RAYLIB_CPP_INCLUDE_COLORSPACE_HPP_
+#define RAYLIB_CPP_INCLUDE_COLORSPACE_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <span>
+
+#include "./Functions.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+#ifdef RAYLIB_CPP_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace raylib {
+/**
+ * sRGB <-> linear-light color conversion.
+ *
+ * raylib stores colors as sRGB encoded bytes. Blending, filtering and lighting should happen on linear values,
+ * so these helpers decode through a 256-entry table and encode through a 4096-entry table.
+ */
+namespace ColorSpace {
+/**
+ * Decode a normalized sRGB value [0..1] to linear light, using the exact sRGB transfer function.
+ */
+[[maybe_unused]] RLCPPAPI inline float SrgbToLinearExact(float value) {
+    return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+}
+
+/**
+ * Encode a linear light value [0..1] to normalized sRGB, using the exact sRGB transfer function.
+ */
+[[maybe_unused]] RLCPPAPI inline float LinearToSrgbExact(float value) {
+    return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+}
+
+/**
+ * Lookup table from an sRGB byte to its linear value [0..1].
+ */
+inline const std::array<float, 256>& GetSrgbToLinearTable() {
+    static const std::array<float, 256> table = [] {
+        std::array<float, 256> values{};
+        for (std::size_t i = 0; i < values.size(); i++) {
+            values[i] = SrgbToLinearExact(static_cast<float>(i) / 255.0f);
+        }
+        return values;
+    }();
+    return table;
+}
+
+/**
+ * Lookup table from a linear value quantized to 12 bits to its sRGB byte.
+ */
+inline const std::array<unsigned char, 4096>& GetLinearToSrgbTable() {
+    static const std::array<unsigned char, 4096> table = [] {
+        std::array<unsigned char, 4096> values{};
+        for (std::size_t i = 0; i < values.size(); i++) {
+            const float srgb = LinearToSrgbExact(static_cast<float>(i) / 4095.0f);
+            values[i] = static_cast<unsigned char>(srgb * 255.0f + 0.5f);
+        }
+        return values;
+    }();
+    return table;
+}
+
+/**
+ * Decode an sRGB byte to linear light [0..1].
+ */
+[[maybe_unused]] RLCPPAPI inline float SrgbToLinear(unsigned char value) {
+    return GetSrgbToLinearTable()[value];
+}
+
+/**
+ * Encode linear light [0..1] to an sRGB byte. Values outside of the range are clamped.
+ */
+[[maybe_unused]] RLCPPAPI inline unsigned char LinearToSrgb(float value) {
+    value = value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+    return GetLinearToSrgbTable()[static_cast<std::size_t>(value * 4095.0f + 0.5f)];
+}
+
+/**
+ * Convert a Color to linear light RGB with a linear alpha, all [0..1].
+ */
+[[maybe_unused]] RLCPPAPI inline ::Vector4 ToLinear(::Color color) {
+    const std::array<float, 256>& table = GetSrgbToLinearTable();
+    return {table[color.r], table[color.g], table[color.b], static_cast<float>(color.a) / 255.0f};
+}
+
+/**
+ * Convert linear light RGB and linear alpha [0..1] back to a Color.
+ */
+[[maybe_unused]] RLCPPAPI inline ::Color FromLinear(::Vector4 linear) {
+    return {
+        LinearToSrgb(linear.x),
+        LinearToSrgb(linear.y),
+        LinearToSrgb(linear.z),
+        static_cast<unsigned char>((linear.w > 0.0f ? (linear.w < 1.0f ? linear.w : 1.0f) : 0.0f) * 255.0f + 0.5f)};
+}
+
+/**
+ * Convert a batch of Colors to linear light. Only min(colors.size(), linear.size()) values are converted.
+ */
+[[maybe_unused]] RLCPPAPI inline void ToLinear(std::span<const ::Color> colors, std::span<::Vector4> linear) {
+    const std::array<float, 256>& table = GetSrgbToLinearTable();
+    const std::size_t count = colors.size() < linear.size() ? colors.size() : linear.size();
+    // Table lookups, which SSE2 has no gather for
+    for (std::size_t i = 0; i < count; i++) {
+        const ::Color color = colors[i];
+        linear[i] = {table[color.r], table[color.g], table[color.b], static_cast<float>(color.a) / 255.0f};
+    }
+}
+
+/**
+ * Convert a batch of linear light values back to Colors. Only min(linear.size(), colors.size()) values are
+ * converted.
+ */
+[[maybe_unused]] RLCPPAPI inline void FromLinear(std::span<const ::Vector4> linear, std::span<::Color> colors) {
+    const std::size_t count = colors.size() < linear.size() ? colors.size() : linear.size();
+#ifdef RAYLIB_CPP_SSE2
+    const std::array<unsigned char, 4096>& table = GetLinearToSrgbTable();
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set_ps(255.0f, 4095.0f, 4095.0f, 4095.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    alignas(16) int indices[4];
+    for (std::size_t i = 0; i < count; i++) {
+        // Clamp, scale and round all four channels at once: table indices for RGB, the byte for alpha.
+        __m128 value = _mm_loadu_ps(&linear[i].x);
+        value = _mm_min_ps(_mm_max_ps(value, zero), one);
+        value = _mm_add_ps(_mm_mul_ps(value, scale), half);
+        _mm_store_si128(reinterpret_cast<__m128i*>(indices), _mm_cvttps_epi32(value));
+        colors[i] = {
+            table[static_cast<std::size_t>(indices[0])],
+            table[static_cast<std::size_t>(indices[1])],
+            table[static_cast<std::size_t>(indices[2])],
+            static_cast<unsigned char>(indices[3])};
+    }
+#else
+    for (std::size_t i = 0; i < count; i++) {
+        colors[i] = FromLinear(linear[i]);
+    }
+#endif
+}
+
+} // namespace ColorSpace
+} // namespace raylib
+
+#endif // RAYLIB_CPP_INCLUDE_COLORSPACE_HPP_
@@ -0,0 +1,259 @@
+#ifndef RAYLIB_CPP_INCLUDE_FRUSTUM_HPP_
+#define RAYLIB_CPP_INCLUDE_FRUSTUM_HPP_
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "./BoundingSphere.hpp"
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+#include "./raymath.hpp"
+
+#ifdef RAYLIB_CPP_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace raylib {
+/**
+ * View frustum as six inward facing planes, for culling on the CPU.
+ *
+ * Whole lists of bounds are culled four at a time with SSE2 into a bit per object, in the layout of
+ * CollisionBatch, before drawing only what can be seen.
+ *
+ * @code
+ * std::vector<uint32_t> visible(raylib::CollisionBatch::GetMaskSize(bounds.size()));
+ * camera.GetFrustum(GetScreenWidth() / static_cast<float>(GetScreenHeight())).CullBoxes(bounds, visible);
+ * for (size_t i = 0; i < models.size(); i++) {
+ *     if (raylib::CollisionBatch::IsHit(visible, i)) {
+ *         models[i].Draw(positions[i]);
+ *     }
+ * }
+ * @endcode
+ */
+class Frustum {
+public:
+    enum Plane { Left = 0, Right, Bottom, Top, Near, Far };
+
+    Frustum() = default;
+
+    /**
+     * Extract the planes from a combined view and projection matrix, i.e. MatrixMultiply(view, projection).
+     *
+     * Pass MatrixMultiply(transform, MatrixMultiply(view, projection)) to get the planes in model space instead.
+     */
+    explicit Frustum(const ::Matrix& viewProjection) {
+        const ::Matrix& m = viewProjection;
+        // Rows of the matrix, as raylib transforms vectors by x' = m0 * x + m4 * y + m8 * z + m12
+        const float rows[4][4] = {
+            {m.m0, m.m4, m.m8, m.m12},
+            {m.m1, m.m5, m.m9, m.m13},
+            {m.m2, m.m6, m.m10, m.m14},
+            {m.m3, m.m7, m.m11, m.m15}};
+
+        for (int i = 0; i < 6; i++) {
+            const float* row = rows[i / 2];
+            const float sign = i % 2 == 0 ? 1.0f : -1.0f;
+            ::Vector4 plane{
+                rows[3][0] + sign * row[0],
+                rows[3][1] + sign * row[1],
+                rows[3][2] + sign * row[2],
+                rows[3][3] + sign * row[3]};
+            const float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+            if (length > 0.0f) {
+                plane = {plane.x / length, plane.y / length, plane.z / length, plane.w / length};
+            }
+            planes[i] = plane;
+        }
+    }
+
+    /**
+     * Extract the planes seen by a camera, with the projection BeginMode3D() sets up for the aspect ratio of the
+     * render target and raylib's default clip distances.
+     */
+    Frustum(const ::Camera3D& camera, float aspect, float nearPlane = 0.01f, float farPlane = 1000.0f)
+        : Frustum(GetViewProjection(camera, aspect, nearPlane, farPlane)) {}
+
+    /**
+     * Plane as (normal.x, normal.y, normal.z, distance), points inside have a positive signed distance.
+     */
+    [[nodiscard]] const ::Vector4& GetPlane(Plane plane) const { return planes[plane]; }
+
+    /**
+     * Whether a point is inside the frustum
+     */
+    [[nodiscard]] bool IsPointVisible(::Vector3 point) const {
+        for (const ::Vector4& plane : planes) {
+            if (Distance(plane, point) < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Whether a sphere is at least partly inside the frustum
+     */
+    [[nodiscard]] bool IsSphereVisible(::Vector3 center, float radius) const {
+        for (const ::Vector4& plane : planes) {
+            if (Distance(plane, center) < -radius) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Whether a box is at least partly inside the frustum, tested with the box corner furthest along each plane
+     */
+    [[nodiscard]] bool IsBoxVisible(const ::BoundingBox& box) const {
+        for (const ::Vector4& plane : planes) {
+            const ::Vector3 corner{
+                plane.x >= 0.0f ? box.max.x : box.min.x,
+                plane.y >= 0.0f ? box.max.y : box.min.y,
+                plane.z >= 0.0f ? box.max.z : box.min.z};
+            if (Distance(plane, corner) < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Test every box like IsBoxVisible().
+     *
+     * @param visible Receives a bit per box, bit i % 32 of word i / 32, i.e. CollisionBatch::GetMaskSize() words.
+     * @return The number of boxes visible.
+     * @throws raylib::RaylibException Throws if the mask is too small.
+     */
+    size_t CullBoxes(std::span<const ::BoundingBox> boxes, std::span<uint32_t> visible) const {
+        const size_t count = boxes.size();
+        Prepare(visible, count);
+        size_t i = 0;
+#ifdef RAYLIB_CPP_SSE2
+        for (; i + 4 <= count; i += 4) {
+            // Boxes are six floats, the first four and the last four of each transpose to one coordinate per register
+            const auto* b = reinterpret_cast<const float*>(boxes.data() + i);
+            __m128 minX = _mm_loadu_ps(b);
+            __m128 minY = _mm_loadu_ps(b + 6);
+            __m128 minZ = _mm_loadu_ps(b + 12);
+            __m128 maxX = _mm_loadu_ps(b + 18);
+            _MM_TRANSPOSE4_PS(minX, minY, minZ, maxX);
+            __m128 spareZ = _mm_loadu_ps(b + 2);
+            __m128 spareX = _mm_loadu_ps(b + 8);
+            __m128 maxY = _mm_loadu_ps(b + 14);
+            __m128 maxZ = _mm_loadu_ps(b + 20);
+            _MM_TRANSPOSE4_PS(spareZ, spareX, maxY, maxZ);
+
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (const ::Vector4& plane : planes) {
+                // The corner furthest along the normal, the same for the four boxes
+                const __m128 distance = Distance(
+                    plane,
+                    plane.x >= 0.0f ? maxX : minX,
+                    plane.y >= 0.0f ? maxY : minY,
+                    plane.z >= 0.0f ? maxZ : minZ);
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+            }
+            visible[i / 32] |= static_cast<uint32_t>(_mm_movemask_ps(inside)) << (i % 32);
+        }
+#endif
+        for (; i < count; i++) {
+            if (IsBoxVisible(boxes[i])) {
+                visible[i / 32] |= 1u << (i % 32);
+            }
+        }
+        return CountVisible(visible, count);
+    }
+
+    /**
+     * Test every sphere like IsSphereVisible().
+     *
+     * @param visible Receives a bit per sphere, bit i % 32 of word i / 32, i.e. CollisionBatch::GetMaskSize() words.
+     * @return The number of spheres visible.
+     * @throws raylib::RaylibException Throws if the mask is too small.
+     */
+    size_t CullSpheres(std::span<const BoundingSphere> spheres, std::span<uint32_t> visible) const {
+        const size_t count = spheres.size();
+        Prepare(visible, count);
+        size_t i = 0;
+#ifdef RAYLIB_CPP_SSE2
+        static_assert(sizeof(BoundingSphere) == sizeof(float) * 4, "BoundingSphere is packed as x, y, z, radius");
+        for (; i + 4 <= count; i += 4) {
+            const auto* s = reinterpret_cast<const float*>(spheres.data() + i);
+            __m128 x = _mm_loadu_ps(s);
+            __m128 y = _mm_loadu_ps(s + 4);
+            __m128 z = _mm_loadu_ps(s + 8);
+            __m128 radius = _mm_loadu_ps(s + 12);
+            _MM_TRANSPOSE4_PS(x, y, z, radius);
+            const __m128 limit = _mm_sub_ps(_mm_setzero_ps(), radius);
+
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (const ::Vector4& plane : planes) {
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(Distance(plane, x, y, z), limit));
+            }
+            visible[i / 32] |= static_cast<uint32_t>(_mm_movemask_ps(inside)) << (i % 32);
+        }
+#endif
+        for (; i < count; i++) {
+            if (IsSphereVisible(spheres[i].center, spheres[i].radius)) {
+                visible[i / 32] |= 1u << (i % 32);
+            }
+        }
+        return CountVisible(visible, count);
+    }
+protected:
+    static ::Matrix GetViewProjection(const ::Camera3D& camera, float aspect, float nearPlane, float farPlane) {
+        ::Matrix projection;
+        if (camera.projection == CAMERA_ORTHOGRAPHIC) {
+            const double top = camera.fovy / 2.0;
+            const double right = top * aspect;
+            projection = ::MatrixOrtho(-right, right, -top, top, nearPlane, farPlane);
+        } else {
+            projection = ::MatrixPerspective(camera.fovy * DEG2RAD, aspect, nearPlane, farPlane);
+        }
+        return ::MatrixMultiply(::MatrixLookAt(camera.position, camera.target, camera.up), projection);
+    }
+
+    static float Distance(const ::Vector4& plane, ::Vector3 point) {
+        return plane.x * point.x + plane.y * point.y + plane.z * point.z + plane.w;
+    }
+
+#ifdef RAYLIB_CPP_SSE2
+    /**
+     * Signed distances of four points, rounded the same as the scalar Distance()
+     */
+    static __m128 Distance(const ::Vector4& plane, __m128 x, __m128 y, __m128 z) {
+        const __m128 distance = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), x), _mm_mul_ps(_mm_set1_ps(plane.y), y)),
+            _mm_mul_ps(_mm_set1_ps(plane.z), z));
+        return _mm_add_ps(distance, _mm_set1_ps(plane.w));
+    }
+#endif
+
+    static void Prepare(std::span<uint32_t> visible, size_t count) {
+        if (visible.size() < (count + 31) / 32) {
+            throw RaylibException("Frustum visibility mask is too small");
+        }
+        std::fill_n(visible.begin(), (count + 31) / 32, 0u);
+    }
+
+    static size_t CountVisible(std::span<const uint32_t> visible, size_t count) {
+        size_t total = 0;
+        for (size_t word = 0; word < (count + 31) / 32; word++) {
+            total += static_cast<size_t>(std::popcount(visible[word]));
+        }
+        return total;
+    }
+
+    ::Vector4 planes[6]{};
+};
+} // namespace raylib
+
+using RFrustum = raylib::Frustum;
+
+#endif // RAYLIB_CPP_INCLUDE_FRUSTUM_HPP_
@@ -1,12 +1,18 @@
 #ifndef RAYLIB_CPP_INCLUDE_IMAGE_HPP_
 #define RAYLIB_CPP_INCLUDE_IMAGE_HPP_
 
+#include <cmath>
+#include <cstring>
 #include <span>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "./Color.hpp"
+#include "./ColorSpace.hpp"
 #include "./RaylibException.hpp"
+#include "./ThreadPool.hpp"
 #include "./raylib-cpp-utils.hpp"
 #include "./raylib.hpp"
 
@@ -486,6 +492,27 @@ public:
         return *this;
     }
 
+    /**
+     * Resize and image to new size, filtering premultiplied colors in linear light
+     *
+     * Unlike Resize(), downsampled edges and gradients keep their perceived brightness.
+     *
+     * @throws raylib::RaylibException Throws if the image is compressed.
+     */
+    Image& ResizeGammaCorrect(int newWidth, int newHeight) {
+        if (data == nullptr || width <= 0 || height <= 0 || newWidth <= 0 || newHeight <= 0) {
+            return *this;
+        }
+
+        const int originalFormat = BeginGammaCorrect();
+        std::vector<::Vector4> pixels = LoadLinearPremultiplied();
+        pixels = ResampleLinear(pixels, width, height, newWidth, height);
+        pixels = ResampleLinear(pixels, newWidth, height, newWidth, newHeight);
+        SetLinearPremultiplied(pixels, newWidth, newHeight);
+        EndGammaCorrect(originalFormat);
+        return *this;
+    }
+
     /**
      * Resize and image to new size using Nearest-Neighbor scaling algorithm
      */
@@ -511,6 +538,79 @@ public:
         return *this;
     }
 
+    /**
+     * Generate all mipmap levels for a provided image, averaging premultiplied colors in linear light
+     *
+     * @throws raylib::RaylibException Throws if the image is compressed.
+     */
+    Image& MipmapsGammaCorrect() {
+        if (data == nullptr || width <= 0 || height <= 0) {
+            return *this;
+        }
+
+        const int originalFormat = BeginGammaCorrect();
+
+        // Levels are built in RGBA8, then converted one by one so ImageFormat() does not regenerate them.
+        std::vector<::Image> levels;
+        std::vector<::Vector4> pixels = LoadLinearPremultiplied();
+        int levelWidth = width;
+        int levelHeight = height;
+        levels.push_back(::ImageCopy(*this));
+        while (levelWidth > 1 || levelHeight > 1) {
+            const int nextWidth = levelWidth > 1 ? levelWidth / 2 : 1;
+            const int nextHeight = levelHeight > 1 ? levelHeight / 2 : 1;
+            std::vector<::Vector4> next(static_cast<size_t>(nextWidth) * static_cast<size_t>(nextHeight));
+            for (int y = 0; y < nextHeight; y++) {
+                const int y0 = levelHeight > 1 ? y * 2 : 0;
+                const int y1 = levelHeight > 1 ? y0 + 1 : 0;
+                for (int x = 0; x < nextWidth; x++) {
+                    const int x0 = levelWidth > 1 ? x * 2 : 0;
+                    const int x1 = levelWidth > 1 ? x0 + 1 : 0;
+                    const ::Vector4& a = pixels[static_cast<size_t>(y0 * levelWidth + x0)];
+                    const ::Vector4& b = pixels[static_cast<size_t>(y0 * levelWidth + x1)];
+                    const ::Vector4& c = pixels[static_cast<size_t>(y1 * levelWidth + x0)];
+                    const ::Vector4& d = pixels[static_cast<size_t>(y1 * levelWidth + x1)];
+                    next[static_cast<size_t>(y * nextWidth + x)] = {
+                        (a.x + b.x + c.x + d.x) * 0.25f,
+                        (a.y + b.y + c.y + d.y) * 0.25f,
+                        (a.z + b.z + c.z + d.z) * 0.25f,
+                        (a.w + b.w + c.w + d.w) * 0.25f};
+                }
+            }
+
+            ::Image level = ::GenImageColor(nextWidth, nextHeight, {0, 0, 0, 0});
+            StoreLinearPremultiplied(next, static_cast<::Color*>(level.data));
+            levels.push_back(level);
+
+            pixels = std::move(next);
+            levelWidth = nextWidth;
+            levelHeight = nextHeight;
+        }
+
+        int totalSize = 0;
+        for (::Image& level : levels) {
+            if (originalFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+                ::ImageFormat(&level, originalFormat);
+            }
+            totalSize += ::GetPixelDataSize(level.width, level.height, level.format);
+        }
+
+        auto* mipData = static_cast<unsigned char*>(RL_MALLOC(static_cast<size_t>(totalSize)));
+        int offset = 0;
+        for (::Image& level : levels) {
+            const int size = ::GetPixelDataSize(level.width, level.height, level.format);
+            memcpy(mipData + offset, level.data, static_cast<size_t>(size));
+            offset += size;
+            ::UnloadImage(level);
+        }
+
+        RL_FREE(data);
+        data = mipData;
+        format = originalFormat;
+        mipmaps = static_cast<int>(levels.size());
+        return *this;
+    }
+
     /**
      * Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
      */
@@ -569,6 +669,31 @@ public:
         return *this;
     }
 
+    /**
+     * Modify image color: tint, multiplying in linear light
+     *
+     * @throws raylib::RaylibException Throws if the image is compressed.
+     */
+    Image& ColorTintGammaCorrect(::Color color = {255, 255, 255, 255}) {
+        if (data == nullptr || width <= 0 || height <= 0) {
+            return *this;
+        }
+
+        const int originalFormat = BeginGammaCorrect();
+        const ::Vector4 tint = ColorSpace::ToLinear(color);
+        const std::span<::Color> pixels(
+            static_cast<::Color*>(data),
+            static_cast<size_t>(width) * static_cast<size_t>(height));
+        std::vector<::Vector4> linear(pixels.size());
+        ColorSpace::ToLinear(pixels, linear);
+        for (::Vector4& pixel : linear) {
+            pixel = {pixel.x * tint.x, pixel.y * tint.y, pixel.z * tint.z, pixel.w * tint.w};
+        }
+        ColorSpace::FromLinear(linear, pixels);
+        EndGammaCorrect(originalFormat);
+        return *this;
+    }
+
     /**
      * Modify image color: invert
      */
@@ -800,6 +925,71 @@ public:
     void KernelConvolution(const float* kernel, int kernelSize) {
         ::ImageKernelConvolution(this, kernel, kernelSize);
     }
+
+    /**
+     * Convert the image to a signed distance field, using an exact Euclidean distance transform
+     *
+     * Pixels with an alpha (or, without alpha channel, a gray level) of at least 50% are inside the shape.
+     * The output stores 0.5 on the edge, growing to 1.0 at spread pixels inside and falling to 0.0 at spread
+     * pixels outside.
+     *
+     * @param spread Distance in pixels covered by the output range.
+     * @param newFormat PIXELFORMAT_UNCOMPRESSED_GRAYSCALE or PIXELFORMAT_UNCOMPRESSED_R32.
+     *
+     * @throws raylib::RaylibException Throws if the image is compressed or the format is not supported.
+     */
+    Image& GenerateSDF(float spread, int newFormat = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) {
+        if (newFormat != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE && newFormat != PIXELFORMAT_UNCOMPRESSED_R32) {
+            throw RaylibException("Signed distance fields are only generated as GRAYSCALE or R32");
+        }
+        if (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) {
+            throw RaylibException("Signed distance fields can not be generated from compressed images");
+        }
+        if (data == nullptr || width <= 0 || height <= 0) {
+            return *this;
+        }
+
+        const bool hasAlpha = format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA ||
+                              format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1 ||
+                              format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4 ||
+                              format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 ||
+                              format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16 ||
+                              format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+        const size_t count = static_cast<size_t>(width) * static_cast<size_t>(height);
+        std::vector<float> outside(count);
+        std::vector<float> inside(count);
+        ::Color* colors = ::LoadImageColors(*this);
+        for (size_t i = 0; i < count; i++) {
+            const bool covered = (hasAlpha ? colors[i].a : colors[i].r) >= 128;
+            outside[i] = covered ? 0.0f : sdfInfinity;
+            inside[i] = covered ? sdfInfinity : 0.0f;
+        }
+        ::UnloadImageColors(colors);
+
+        DistanceTransform(outside, width, height);
+        DistanceTransform(inside, width, height);
+
+        spread = spread > 0.0f ? spread : 1.0f;
+        const size_t pixelSize = newFormat == PIXELFORMAT_UNCOMPRESSED_R32 ? sizeof(float) : 1;
+        auto* output = static_cast<unsigned char*>(RL_MALLOC(count * pixelSize));
+        for (size_t i = 0; i < count; i++) {
+            // Measure from the pixel edge rather than the pixel center so the 0.5 level lies on the boundary.
+            const float distance = outside[i] > 0.0f ? std::sqrt(outside[i]) - 0.5f : 0.5f - std::sqrt(inside[i]);
+            float value = 0.5f - distance / (2.0f * spread);
+            value = value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+            if (newFormat == PIXELFORMAT_UNCOMPRESSED_R32) {
+                reinterpret_cast<float*>(output)[i] = value;
+            } else {
+                output[i] = static_cast<unsigned char>(value * 255.0f + 0.5f);
+            }
+        }
+
+        RL_FREE(data);
+        data = output;
+        mipmaps = 1;
+        format = newFormat;
+        return *this;
+    }
 protected:
     void set(const ::Image& image) {
         data = image.data;
@@ -808,6 +998,197 @@ protected:
         mipmaps = image.mipmaps;
         format = image.format;
     }
+
+    static constexpr float sdfInfinity = 1e20f;
+
+    /**
+     * Squared distance transform of a sampled function along one line (Felzenszwalb & Huttenlocher).
+     *
+     * @param values Line read with the given stride, replaced by the transformed values.
+     */
+    static void DistanceTransformLine(
+        float* values,
+        size_t stride,
+        int length,
+        std::vector<float>& line,
+        std::vector<int>& parabolas,
+        std::vector<float>& boundaries) {
+        const auto size = static_cast<size_t>(length);
+        for (size_t i = 0; i < size; i++) {
+            line[i] = values[i * stride];
+        }
+
+        // Lower envelope of the parabolas rooted at each sample.
+        int k = 0;
+        parabolas[0] = 0;
+        boundaries[0] = -sdfInfinity;
+        boundaries[1] = sdfInfinity;
+        const auto intersection = [&line](int q, int v) {
+            const float fq = line[static_cast<size_t>(q)] + static_cast<float>(q * q);
+            const float fv = line[static_cast<size_t>(v)] + static_cast<float>(v * v);
+            return (fq - fv) / static_cast<float>(2 * (q - v));
+        };
+        for (int q = 1; q < length; q++) {
+            float s = intersection(q, parabolas[static_cast<size_t>(k)]);
+            while (s <= boundaries[static_cast<size_t>(k)]) {
+                k--;
+                s = intersection(q, parabolas[static_cast<size_t>(k)]);
+            }
+            k++;
+            parabolas[static_cast<size_t>(k)] = q;
+            boundaries[static_cast<size_t>(k)] = s;
+            boundaries[static_cast<size_t>(k + 1)] = sdfInfinity;
+        }
+
+        k = 0;
+        for (int q = 0; q < length; q++) {
+            while (boundaries[static_cast<size_t>(k + 1)] < static_cast<float>(q)) {
+                k++;
+            }
+            const int v = parabolas[static_cast<size_t>(k)];
+            values[static_cast<size_t>(q) * stride] =
+                static_cast<float>((q - v) * (q - v)) + line[static_cast<size_t>(v)];
+        }
+    }
+
+    /**
+     * Squared Euclidean distance transform of a 2D grid, columns then rows, each split across the thread pool.
+     */
+    static void DistanceTransform(std::vector<float>& grid, int gridWidth, int gridHeight) {
+        constexpr size_t linesPerTask = 16;
+        const size_t longest = static_cast<size_t>(gridWidth > gridHeight ? gridWidth : gridHeight);
+        ThreadPool& pool = ThreadPool::GetDefault();
+
+        const auto transform = [&](size_t lineCount, size_t lineStart, size_t stride, int length) {
+            pool.ParallelFor(lineCount, linesPerTask, [&](size_t first, size_t last) {
+                std::vector<float> line(longest);
+                std::vector<int> parabolas(longest);
+                std::vector<float> boundaries(longest + 1);
+                for (size_t i = first; i < last; i++) {
+                    DistanceTransformLine(grid.data() + i * lineStart, stride, length, line, parabolas, boundaries);
+                }
+            });
+        };
+        transform(static_cast<size_t>(gridWidth), 1, static_cast<size_t>(gridWidth), gridHeight);
+        transform(static_cast<size_t>(gridHeight), static_cast<size_t>(gridWidth), 1, gridWidth);
+    }
+
+    /**
+     * Converts the image to single level RGBA8 for the gamma correct operations, returning the original format.
+     */
+    int BeginGammaCorrect() {
+        if (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) {
+            throw RaylibException("Gamma correct operations do not support compressed images");
+        }
+
+        const int originalFormat = format;
+        mipmaps = 1;
+        if (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+            ::ImageFormat(this, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        }
+        return originalFormat;
+    }
+
+    void EndGammaCorrect(int originalFormat) {
+        if (format != originalFormat) {
+            ::ImageFormat(this, originalFormat);
+        }
+    }
+
+    /**
+     * Decodes the RGBA8 pixels to linear light with premultiplied alpha.
+     */
+    [[nodiscard]] std::vector<::Vector4> LoadLinearPremultiplied() const {
+        const size_t count = static_cast<size_t>(width) * static_cast<size_t>(height);
+        std::vector<::Vector4> pixels(count);
+        ColorSpace::ToLinear(std::span<const ::Color>(static_cast<const ::Color*>(data), count), pixels);
+        for (::Vector4& pixel : pixels) {
+            pixel.x *= pixel.w;
+            pixel.y *= pixel.w;
+            pixel.z *= pixel.w;
+        }
+        return pixels;
+    }
+
+    /**
+     * Encodes premultiplied linear pixels back to sRGB bytes.
+     */
+    static void StoreLinearPremultiplied(std::vector<::Vector4>& pixels, ::Color* colors) {
+        for (::Vector4& pixel : pixels) {
+            if (pixel.w > 0.0f) {
+                pixel.x /= pixel.w;
+                pixel.y /= pixel.w;
+                pixel.z /= pixel.w;
+            }
+        }
+        ColorSpace::FromLinear(pixels, std::span<::Color>(colors, pixels.size()));
+    }
+
+    /**
+     * Replaces the image data with premultiplied linear pixels of the given size, as RGBA8.
+     */
+    void SetLinearPremultiplied(std::vector<::Vector4>& pixels, int newWidth, int newHeight) {
+        auto* colors = static_cast<::Color*>(RL_MALLOC(pixels.size() * sizeof(::Color)));
+        StoreLinearPremultiplied(pixels, colors);
+        RL_FREE(data);
+        data = colors;
+        width = newWidth;
+        height = newHeight;
+        mipmaps = 1;
+        format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    }
+
+    /**
+     * Resamples along one axis with a tent filter, widened to the source footprint when downscaling.
+     *
+     * Only one of the dimensions may change per call.
+     */
+    static std::vector<::Vector4> ResampleLinear(
+        const std::vector<::Vector4>& src,
+        int srcWidth,
+        int srcHeight,
+        int dstWidth,
+        int dstHeight) {
+        const bool horizontal = srcWidth != dstWidth;
+        const int srcLength = horizontal ? srcWidth : srcHeight;
+        const int dstLength = horizontal ? dstWidth : dstHeight;
+        if (srcLength == dstLength) {
+            return src;
+        }
+
+        const float scale = static_cast<float>(srcLength) / static_cast<float>(dstLength);
+        const float radius = scale > 1.0f ? scale : 1.0f;
+        std::vector<::Vector4> dst(static_cast<size_t>(dstWidth) * static_cast<size_t>(dstHeight));
+        for (int i = 0; i < dstLength; i++) {
+            const float center = (static_cast<float>(i) + 0.5f) * scale - 0.5f;
+            int first = static_cast<int>(std::ceil(center - radius));
+            int last = static_cast<int>(std::floor(center + radius));
+            first = first < 0 ? 0 : first;
+            last = last > srcLength - 1 ? srcLength - 1 : last;
+
+            const int lines = horizontal ? dstHeight : dstWidth;
+            for (int line = 0; line < lines; line++) {
+                ::Vector4 sum{0.0f, 0.0f, 0.0f, 0.0f};
+                float weightSum = 0.0f;
+                for (int j = first; j <= last; j++) {
+                    const float weight = 1.0f - std::fabs(static_cast<float>(j) - center) / radius;
+                    if (weight <= 0.0f) {
+                        continue;
+                    }
+                    const ::Vector4& pixel = horizontal ? src[static_cast<size_t>(line * srcWidth + j)]
+                                                        : src[static_cast<size_t>(j * srcWidth + line)];
+                    sum = {sum.x + pixel.x * weight, sum.y + pixel.y * weight, sum.z + pixel.z * weight,
+                           sum.w + pixel.w * weight};
+                    weightSum += weight;
+                }
+                if (weightSum > 0.0f) {
+                    sum = {sum.x / weightSum, sum.y / weightSum, sum.z / weightSum, sum.w / weightSum};
+                }
+                dst[static_cast<size_t>(horizontal ? line * dstWidth + i : i * dstWidth + line)] = sum;
+            }
+        }
+        return dst;
+    }
 };
 } // namespace raylib
 
@@ -0,0 +1,619 @@
+#ifndef RAYLIB_CPP_INCLUDE_IMAGEANIMSTREAM_HPP_
+#define RAYLIB_CPP_INCLUDE_IMAGEANIMSTREAM_HPP_
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "./FileData.hpp"
+#include "./Image.hpp"
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Streams the frames of an animated image into one reusable RGBA8 Image.
+ *
+ * Unlike LoadImageAnim(), which decodes every frame into one tall buffer, GIF frames are decoded on demand by a
+ * background thread that keeps a few frames ahead of the current one. Other formats fall back to
+ * LoadImageAnim().
+ *
+ * @code
+ * raylib::ImageAnimStream anim("cat.gif");
+ * raylib::Texture texture(anim.GetImage());
+ * ...
+ * texture.Update(anim.Next().data);
+ * @endcode
+ */
+class ImageAnimStream {
+public:
+    ImageAnimStream() = default;
+
+    /**
+     * Opens an animated image and decodes its first frame.
+     *
+     * @param lookAhead Frames decoded ahead of the current one.
+     * @param maxCachedFrames Already shown frames kept decoded, so that looping or seeking back is cheap.
+     *
+     * @throws raylib::RaylibException Throws if the file could not be loaded or is not a valid image.
+     */
+    ImageAnimStream(const std::string_view fileName, int lookAhead = 2, int maxCachedFrames = 0) {
+        Load(fileName, lookAhead, maxCachedFrames);
+    }
+
+    ImageAnimStream(const ImageAnimStream&) = delete;
+    ImageAnimStream& operator=(const ImageAnimStream&) = delete;
+
+    ~ImageAnimStream() { Unload(); }
+
+    GETTER(int, Width, width)
+    GETTER(int, Height, height)
+    GETTER(int, FrameCount, frameCount)
+    GETTER(int, FrameIndex, frameIndex)
+
+    /**
+     * @see Load()
+     */
+    void Load(const std::string_view fileName, int lookAhead = 2, int maxCachedFrames = 0) {
+        Unload();
+        this->lookAhead = lookAhead > 0 ? lookAhead : 0;
+        this->maxCachedFrames = maxCachedFrames > 0 ? maxCachedFrames : 0;
+
+        // A corrupt file leaves no half loaded state, nor a running thread to destroy
+        try {
+            file.Load(fileName);
+            if (file.GetData() == nullptr) {
+                throw RaylibException(TextFormat("Failed to load animated image: %s", fileName.data()));
+            }
+
+            if (!ParseGif()) {
+                file.Unload();
+                LoadFallback(fileName);
+                return;
+            }
+
+            image = ::GenImageColor(width, height, {0, 0, 0, 0});
+            ResetDecoder();
+            worker = std::thread([this] { Stream(); });
+            Seek(0);
+        } catch (...) {
+            Unload();
+            throw;
+        }
+    }
+
+    /**
+     * Stops the decoding thread and releases all frames.
+     */
+    void Unload() {
+        if (worker.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            requestChanged.notify_all();
+            worker.join();
+        }
+
+        stopping = false;
+        error = nullptr;
+        cache.clear();
+        frames.clear();
+        file.Unload();
+        fallback.Unload();
+        image.Unload();
+        width = 0;
+        height = 0;
+        frameCount = 0;
+        frameIndex = 0;
+        requested = 0;
+        globalPaletteOffset = 0;
+        globalPaletteSize = 0;
+    }
+
+    [[nodiscard]] bool IsValid() const { return frameCount > 0 && image.data != nullptr; }
+
+    /**
+     * The current frame, RGBA8 and of the same size for all frames.
+     */
+    [[nodiscard]] const Image& GetImage() const { return image; }
+
+    /**
+     * Delay of the given frame in seconds, 0.0f when unknown.
+     */
+    [[nodiscard]] float GetFrameDelay(int index) const {
+        if (index < 0 || index >= static_cast<int>(frames.size())) {
+            return 0.0f;
+        }
+        return frames[static_cast<size_t>(index)].delay;
+    }
+
+    /**
+     * Advances to the next frame, looping back to the first one.
+     */
+    const Image& Next() { return Seek(frameCount > 0 ? (frameIndex + 1) % frameCount : 0); }
+
+    /**
+     * Makes the given frame current, waiting for it to be decoded.
+     *
+     * @throws raylib::RaylibException Throws if the frame index is out of range or the file is corrupt.
+     */
+    const Image& Seek(int index) {
+        if (index < 0 || index >= frameCount) {
+            throw RaylibException(TextFormat("Animated image frame %i out of range", index));
+        }
+
+        const size_t frameSize = GetFrameSize();
+        if (fallback.data != nullptr) {
+            frameIndex = index;
+            memcpy(image.data, static_cast<unsigned char*>(fallback.data) + frameSize * static_cast<size_t>(index),
+                frameSize);
+            return image;
+        }
+
+        std::shared_ptr<const std::vector<unsigned char>> pixels;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            requested = index;
+            frameIndex = index;
+            Evict();
+            requestChanged.notify_all();
+            frameDecoded.wait(lock, [this, index] { return error != nullptr || cache.count(index) > 0; });
+            if (error != nullptr) {
+                std::rethrow_exception(error);
+            }
+
+            CachedFrame& cached = cache[index];
+            cached.lastUse = ++useCounter;
+            pixels = cached.pixels;
+        }
+
+        memcpy(image.data, pixels->data(), frameSize);
+        return image;
+    }
+protected:
+    struct GifFrame {
+        int left{0};
+        int top{0};
+        int width{0};
+        int height{0};
+        bool interlaced{false};
+        size_t paletteOffset{0};
+        int paletteSize{0};
+        size_t dataOffset{0};
+        int transparentIndex{-1};
+        int disposal{0};
+        float delay{0.0f};
+    };
+
+    struct CachedFrame {
+        std::shared_ptr<const std::vector<unsigned char>> pixels{};
+        uint64_t lastUse{0};
+    };
+
+    [[nodiscard]] size_t GetFrameSize() const {
+        return static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
+    }
+
+    void LoadFallback(const std::string_view fileName) {
+        int count = 0;
+        fallback = ::LoadImageAnim(fileName.data(), &count);
+        if (fallback.data == nullptr || count <= 0) {
+            fallback.Unload();
+            throw RaylibException(TextFormat("Failed to load animated image: %s", fileName.data()));
+        }
+
+        fallback.Format(PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        width = fallback.width;
+        height = fallback.height / count;
+        frameCount = count;
+        image = ::GenImageColor(width, height, {0, 0, 0, 0});
+        Seek(0);
+    }
+
+    [[nodiscard]] unsigned char ReadByte(size_t offset) const {
+        if (offset >= static_cast<size_t>(file.GetBytesRead())) {
+            throw RaylibException("Animated image is truncated");
+        }
+        return file.GetData()[offset];
+    }
+
+    /**
+     * Makes sure the file has the given number of bytes, i.e. that a color table is complete.
+     */
+    void CheckSize(size_t size) const {
+        if (size > static_cast<size_t>(file.GetBytesRead())) {
+            throw RaylibException("Animated image is truncated");
+        }
+    }
+
+    [[nodiscard]] int ReadShort(size_t offset) const { return ReadByte(offset) | (ReadByte(offset + 1) << 8); }
+
+    void SkipSubBlocks(size_t& offset) const {
+        for (unsigned char size = ReadByte(offset++); size != 0; size = ReadByte(offset++)) {
+            offset += size;
+        }
+    }
+
+    /**
+     * Indexes the frames of a GIF file without decoding them, returns false for other formats.
+     */
+    bool ParseGif() {
+        if (file.GetBytesRead() < 13 || memcmp(file.GetData(), "GIF8", 4) != 0) {
+            return false;
+        }
+
+        width = ReadShort(6);
+        height = ReadShort(8);
+        if (width <= 0 || height <= 0) {
+            throw RaylibException("Animated image has no size");
+        }
+
+        const unsigned char screen = ReadByte(10);
+        size_t offset = 13;
+        if ((screen & 0x80) != 0) {
+            globalPaletteOffset = offset;
+            globalPaletteSize = 1 << ((screen & 0x07) + 1);
+            offset += static_cast<size_t>(globalPaletteSize) * 3;
+            CheckSize(offset);
+        }
+
+        GifFrame next;
+        for (bool reading = true; reading && offset < static_cast<size_t>(file.GetBytesRead());) {
+            switch (ReadByte(offset++)) {
+                case 0x21: {
+                    const unsigned char label = ReadByte(offset++);
+                    if (label == 0xF9) {
+                        // Graphic control extension: disposal, delay in 1/100s and transparent color index.
+                        const unsigned char flags = ReadByte(offset + 1);
+                        next.disposal = (flags >> 2) & 0x07;
+                        next.delay = static_cast<float>(ReadShort(offset + 2)) / 100.0f;
+                        next.transparentIndex = (flags & 0x01) != 0 ? ReadByte(offset + 4) : -1;
+                        offset += 1 + static_cast<size_t>(ReadByte(offset));
+                    }
+                    SkipSubBlocks(offset);
+                    break;
+                }
+                case 0x2C: {
+                    next.left = ReadShort(offset);
+                    next.top = ReadShort(offset + 2);
+                    next.width = ReadShort(offset + 4);
+                    next.height = ReadShort(offset + 6);
+                    const unsigned char flags = ReadByte(offset + 8);
+                    offset += 9;
+
+                    next.interlaced = (flags & 0x40) != 0;
+                    if ((flags & 0x80) != 0) {
+                        next.paletteOffset = offset;
+                        next.paletteSize = 1 << ((flags & 0x07) + 1);
+                        offset += static_cast<size_t>(next.paletteSize) * 3;
+                        CheckSize(offset);
+                    } else {
+                        next.paletteOffset = globalPaletteOffset;
+                        next.paletteSize = globalPaletteSize;
+                    }
+                    if (next.paletteSize == 0) {
+                        throw RaylibException("Animated image frame has no color table");
+                    }
+
+                    next.dataOffset = offset++;
+                    SkipSubBlocks(offset);
+                    frames.push_back(next);
+                    next = GifFrame();
+                    break;
+                }
+                default:
+                    // Trailer, or trailing garbage after the last complete frame.
+                    reading = false;
+                    break;
+            }
+        }
+
+        if (frames.empty()) {
+            throw RaylibException("Animated image has no frames");
+        }
+        frameCount = static_cast<int>(frames.size());
+        return true;
+    }
+
+    /**
+     * Background thread: decodes the first missing frame of the look-ahead window, one frame at a time so that
+     * seeking takes effect quickly.
+     */
+    void Stream() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopping) {
+            const int target = FindMissingFrame();
+            if (target < 0) {
+                requestChanged.wait(lock);
+                continue;
+            }
+            lock.unlock();
+
+            std::shared_ptr<const std::vector<unsigned char>> pixels;
+            const int decoded = target < decoderPosition ? 0 : decoderPosition;
+            std::exception_ptr decodeError;
+            try {
+                if (target < decoderPosition) {
+                    ResetDecoder();
+                }
+                pixels = DecodeNextFrame();
+            } catch (...) {
+                decodeError = std::current_exception();
+            }
+
+            lock.lock();
+            if (decodeError != nullptr) {
+                error = decodeError;
+                frameDecoded.notify_all();
+                return;
+            }
+            if (IsInWindow(decoded) || maxCachedFrames > 0) {
+                cache[decoded] = {pixels, ++useCounter};
+                Evict();
+                frameDecoded.notify_all();
+            }
+        }
+    }
+
+    [[nodiscard]] bool IsInWindow(int index) const {
+        return (index - requested + frameCount) % frameCount <= lookAhead;
+    }
+
+    [[nodiscard]] int FindMissingFrame() const {
+        for (int i = 0; i <= lookAhead && i < frameCount; i++) {
+            const int index = (requested + i) % frameCount;
+            if (cache.count(index) == 0) {
+                return index;
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * Drops the least recently used frames outside of the look-ahead window beyond maxCachedFrames.
+     */
+    void Evict() {
+        for (;;) {
+            int outside = 0;
+            auto oldest = cache.end();
+            for (auto it = cache.begin(); it != cache.end(); ++it) {
+                if (IsInWindow(it->first)) {
+                    continue;
+                }
+                outside++;
+                if (oldest == cache.end() || it->second.lastUse < oldest->second.lastUse) {
+                    oldest = it;
+                }
+            }
+            if (outside <= maxCachedFrames) {
+                return;
+            }
+            cache.erase(oldest);
+        }
+    }
+
+    void ResetDecoder() {
+        canvas.assign(GetFrameSize(), 0);
+        decoderPosition = 0;
+        pendingDisposal = 0;
+    }
+
+    /**
+     * Composes the frame at decoderPosition onto the canvas and returns a copy of the canvas.
+     */
+    std::shared_ptr<const std::vector<unsigned char>> DecodeNextFrame() {
+        const GifFrame& frame = frames[static_cast<size_t>(decoderPosition)];
+
+        // Dispose of the previous frame: 2 clears its area, 3 restores the canvas from before it was drawn.
+        if (pendingDisposal == 2) {
+            FillRect(pendingFrame, {0, 0, 0, 0});
+        } else if (pendingDisposal == 3) {
+            canvas = savedCanvas;
+        }
+        if (frame.disposal == 3) {
+            savedCanvas = canvas;
+        }
+
+        indices.assign(static_cast<size_t>(frame.width) * static_cast<size_t>(frame.height), 0);
+        DecodeLzw(frame);
+
+        const unsigned char* palette = file.GetData() + frame.paletteOffset;
+        for (int row = 0; row < frame.height; row++) {
+            const int y = frame.top + InterlacedRow(frame, row);
+            if (y >= height) {
+                continue;
+            }
+            for (int x = 0; x < frame.width && frame.left + x < width; x++) {
+                const int index = indices[static_cast<size_t>(row) * static_cast<size_t>(frame.width) +
+                                          static_cast<size_t>(x)];
+                // Indices past the color table are left transparent
+                if (index == frame.transparentIndex || index >= frame.paletteSize) {
+                    continue;
+                }
+                unsigned char* pixel = canvas.data() + (static_cast<size_t>(y) * static_cast<size_t>(width) +
+                                                        static_cast<size_t>(frame.left + x)) * 4;
+                pixel[0] = palette[index * 3];
+                pixel[1] = palette[index * 3 + 1];
+                pixel[2] = palette[index * 3 + 2];
+                pixel[3] = 255;
+            }
+        }
+
+        pendingDisposal = frame.disposal;
+        pendingFrame = frame;
+        decoderPosition++;
+        return std::make_shared<const std::vector<unsigned char>>(canvas);
+    }
+
+    /**
+     * Maps the n-th stored row of an interlaced frame to its row in the frame.
+     */
+    static int InterlacedRow(const GifFrame& frame, int row) {
+        if (!frame.interlaced) {
+            return row;
+        }
+        const int pass1 = (frame.height + 7) / 8;
+        const int pass2 = (frame.height + 3) / 8;
+        const int pass3 = (frame.height + 1) / 4;
+        if (row < pass1) {
+            return row * 8;
+        }
+        row -= pass1;
+        if (row < pass2) {
+            return 4 + row * 8;
+        }
+        row -= pass2;
+        if (row < pass3) {
+            return 2 + row * 4;
+        }
+        return 1 + (row - pass3) * 2;
+    }
+
+    void FillRect(const GifFrame& frame, ::Color color) {
+        for (int y = frame.top; y < frame.top + frame.height && y < height; y++) {
+            for (int x = frame.left; x < frame.left + frame.width && x < width; x++) {
+                memcpy(canvas.data() + (static_cast<size_t>(y) * static_cast<size_t>(width) +
+                                        static_cast<size_t>(x)) * 4, &color, 4);
+            }
+        }
+    }
+
+    /**
+     * Decodes the LZW compressed color indices of a frame into indices.
+     */
+    void DecodeLzw(const GifFrame& frame) {
+        size_t offset = frame.dataOffset;
+        // Color indices are bytes, so wider roots would not fit the 8-bit suffixes and stack
+        const int minCodeSize = ReadByte(offset++);
+        if (minCodeSize < 2 || minCodeSize > 8) {
+            throw RaylibException("Animated image has an invalid LZW code size");
+        }
+
+        constexpr int maxCodes = 4096;
+        const int clearCode = 1 << minCodeSize;
+        const int endCode = clearCode + 1;
+        for (int i = 0; i < clearCode; i++) {
+            suffix[static_cast<size_t>(i)] = static_cast<unsigned char>(i);
+        }
+
+        int codeSize = minCodeSize + 1;
+        int nextCode = endCode + 1;
+        int previous = -1;
+        int first = 0;
+        size_t output = 0;
+        size_t blockRemaining = 0;
+        uint32_t bits = 0;
+        int bitCount = 0;
+        for (;;) {
+            while (bitCount < codeSize) {
+                if (blockRemaining == 0) {
+                    blockRemaining = ReadByte(offset++);
+                    if (blockRemaining == 0) {
+                        return;
+                    }
+                }
+                bits |= static_cast<uint32_t>(ReadByte(offset++)) << bitCount;
+                bitCount += 8;
+                blockRemaining--;
+            }
+            int code = static_cast<int>(bits & ((1u << codeSize) - 1));
+            bits >>= codeSize;
+            bitCount -= codeSize;
+
+            if (code == clearCode) {
+                codeSize = minCodeSize + 1;
+                nextCode = endCode + 1;
+                previous = -1;
+                continue;
+            }
+            if (code == endCode || code > nextCode || (previous < 0 && code > clearCode)) {
+                return;
+            }
+
+            size_t length = 0;
+            const int current = code;
+            if (previous < 0) {
+                first = code;
+                stack[length++] = static_cast<unsigned char>(code);
+            } else {
+                if (code == nextCode) {
+                    stack[length++] = static_cast<unsigned char>(first);
+                    code = previous;
+                }
+                while (code > clearCode) {
+                    stack[length++] = suffix[static_cast<size_t>(code)];
+                    code = prefix[static_cast<size_t>(code)];
+                }
+                first = code;
+                stack[length++] = static_cast<unsigned char>(first);
+
+                if (nextCode < maxCodes) {
+                    prefix[static_cast<size_t>(nextCode)] = static_cast<uint16_t>(previous);
+                    suffix[static_cast<size_t>(nextCode)] = static_cast<unsigned char>(first);
+                    nextCode++;
+                    if (nextCode == (1 << codeSize) && codeSize < 12) {
+                        codeSize++;
+                    }
+                }
+            }
+            previous = current;
+
+            while (length > 0 && output < indices.size()) {
+                indices[output++] = stack[--length];
+            }
+        }
+    }
+
+    // Shared with the decoding thread, guarded by mutex
+    std::mutex mutex{};
+    std::condition_variable requestChanged{};
+    std::condition_variable frameDecoded{};
+    std::map<int, CachedFrame> cache{};
+    std::exception_ptr error{};
+    uint64_t useCounter{0};
+    int requested{0};
+    bool stopping{false};
+
+    // Read-only while the decoding thread runs
+    FileData file{};
+    std::vector<GifFrame> frames{};
+    size_t globalPaletteOffset{0};
+    int globalPaletteSize{0};
+    int lookAhead{2};
+    int maxCachedFrames{0};
+    int width{0};
+    int height{0};
+    int frameCount{0};
+
+    // Owned by the decoding thread
+    std::vector<unsigned char> canvas{};
+    std::vector<unsigned char> savedCanvas{};
+    std::vector<unsigned char> indices{};
+    std::array<uint16_t, 4096> prefix{};
+    std::array<unsigned char, 4096> suffix{};
+    std::array<unsigned char, 4097> stack{};
+    GifFrame pendingFrame{};
+    int pendingDisposal{0};
+    int decoderPosition{0};
+
+    // Owned by the caller
+    Image image{};
+    Image fallback{};
+    int frameIndex{0};
+    std::thread worker{};
+};
+} // namespace raylib
+
+using RImageAnimStream = raylib::ImageAnimStream;
+
+#endif // RAYLIB_CPP_INCLUDE_IMAGEANIMSTREAM_HPP_
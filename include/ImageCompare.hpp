@@ -0,0 +1,323 @@
+#ifndef RAYLIB_CPP_INCLUDE_IMAGECOMPARE_HPP_
+#define RAYLIB_CPP_INCLUDE_IMAGECOMPARE_HPP_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include "./Image.hpp"
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+#ifdef RAYLIB_CPP_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace raylib {
+/**
+ * Compares two images of the same size, i.e. a rendered frame against a golden image.
+ *
+ * Images that are not RGBA8 are converted once on construction, the source images are not modified.
+ */
+class ImageCompare {
+public:
+    /**
+     * Per-channel statistics of the absolute difference between two images, channels are R, G, B, A.
+     */
+    struct Result {
+        std::array<unsigned char, 4> maxError{};
+        std::array<float, 4> meanError{};
+        std::array<float, 4> meanSquaredError{};
+
+        /** Pixels with at least one channel differing by more than the tolerance */
+        size_t differentPixels{0};
+
+        /** Peak signal-to-noise ratio over RGB in dB, infinity when the images are identical */
+        float psnr{0.0f};
+    };
+
+    /**
+     * @throws raylib::RaylibException Throws if either image is empty, compressed, or the sizes differ.
+     */
+    ImageCompare(const ::Image& expected, const ::Image& actual)
+        : width(expected.width),
+          height(expected.height),
+          expectedCopy(),
+          actualCopy() {
+        if (expected.data == nullptr || actual.data == nullptr) {
+            throw RaylibException("Failed to compare images: image has no data");
+        }
+        if (expected.width != actual.width || expected.height != actual.height) {
+            throw RaylibException(TextFormat(
+                "Failed to compare images: size %ix%i differs from %ix%i",
+                actual.width,
+                actual.height,
+                expected.width,
+                expected.height));
+        }
+
+        expectedPixels = Prepare(expected, expectedCopy);
+        actualPixels = Prepare(actual, actualCopy);
+    }
+
+    ImageCompare(const ImageCompare&) = delete;
+    ImageCompare& operator=(const ImageCompare&) = delete;
+
+    GETTER(int, Width, width)
+    GETTER(int, Height, height)
+
+    /**
+     * Computes the difference statistics over all pixels.
+     *
+     * @param tolerance Channel difference that is still counted as equal for Result::differentPixels.
+     */
+    [[nodiscard]] Result Compare(unsigned char tolerance = 0) const {
+        Accumulator total;
+        const size_t count = GetPixelCount();
+        for (size_t offset = 0; offset < count; offset += blockSize) {
+            const size_t size = count - offset < blockSize ? count - offset : blockSize;
+            Accumulate(expectedPixels + offset, actualPixels + offset, size, tolerance, total);
+        }
+
+        Result result;
+        result.differentPixels = total.different;
+        const auto pixels = static_cast<double>(count > 0 ? count : 1);
+        double rgbSquaredError = 0.0;
+        for (size_t channel = 0; channel < 4; channel++) {
+            result.maxError[channel] = total.max[channel];
+            result.meanError[channel] = static_cast<float>(static_cast<double>(total.sum[channel]) / pixels);
+            result.meanSquaredError[channel] =
+                static_cast<float>(static_cast<double>(total.squared[channel]) / pixels);
+            if (channel < 3) {
+                rgbSquaredError += static_cast<double>(total.squared[channel]);
+            }
+        }
+
+        const double mse = rgbSquaredError / (pixels * 3.0);
+        result.psnr = mse > 0.0 ? static_cast<float>(10.0 * std::log10(255.0 * 255.0 / mse))
+                                : std::numeric_limits<float>::infinity();
+        return result;
+    }
+
+    /**
+     * Checks whether the images match, returning as soon as too many pixels differ.
+     *
+     * @param tolerance Channel difference that is still counted as equal.
+     * @param maxDifferentPixels Number of differing pixels that is still accepted.
+     */
+    [[nodiscard]] bool IsWithin(unsigned char tolerance = 0, size_t maxDifferentPixels = 0) const {
+        Accumulator total;
+        const size_t count = GetPixelCount();
+        for (size_t offset = 0; offset < count; offset += earlyExitBlockSize) {
+            const size_t size = count - offset < earlyExitBlockSize ? count - offset : earlyExitBlockSize;
+            Accumulate(expectedPixels + offset, actualPixels + offset, size, tolerance, total);
+            if (total.different > maxDifferentPixels) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Mean structural similarity of the luma channels, 1.0f for identical images.
+     *
+     * Uses 8x8 windows with a stride of 4 pixels, smaller images are treated as a single window.
+     */
+    [[nodiscard]] float GetSSIM() const {
+        const std::vector<float> expectedLuma = LoadLuma(expectedPixels);
+        const std::vector<float> actualLuma = LoadLuma(actualPixels);
+
+        const int windowWidth = width < ssimWindow ? width : ssimWindow;
+        const int windowHeight = height < ssimWindow ? height : ssimWindow;
+        constexpr float c1 = (0.01f * 255.0f) * (0.01f * 255.0f);
+        constexpr float c2 = (0.03f * 255.0f) * (0.03f * 255.0f);
+        const float samples = static_cast<float>(windowWidth * windowHeight);
+
+        double total = 0.0;
+        int windows = 0;
+        for (int y = 0; y + windowHeight <= height; y += ssimStride) {
+            for (int x = 0; x + windowWidth <= width; x += ssimStride) {
+                float sumA = 0.0f;
+                float sumB = 0.0f;
+                float sumAA = 0.0f;
+                float sumBB = 0.0f;
+                float sumAB = 0.0f;
+                for (int j = 0; j < windowHeight; j++) {
+                    const size_t row = static_cast<size_t>(y + j) * static_cast<size_t>(width);
+                    for (int i = 0; i < windowWidth; i++) {
+                        const float a = expectedLuma[row + static_cast<size_t>(x + i)];
+                        const float b = actualLuma[row + static_cast<size_t>(x + i)];
+                        sumA += a;
+                        sumB += b;
+                        sumAA += a * a;
+                        sumBB += b * b;
+                        sumAB += a * b;
+                    }
+                }
+
+                const float meanA = sumA / samples;
+                const float meanB = sumB / samples;
+                const float varianceA = sumAA / samples - meanA * meanA;
+                const float varianceB = sumBB / samples - meanB * meanB;
+                const float covariance = sumAB / samples - meanA * meanB;
+                total += static_cast<double>(
+                    ((2.0f * meanA * meanB + c1) * (2.0f * covariance + c2)) /
+                    ((meanA * meanA + meanB * meanB + c1) * (varianceA + varianceB + c2)));
+                windows++;
+            }
+        }
+
+        return windows > 0 ? static_cast<float>(total / windows) : 1.0f;
+    }
+
+    /**
+     * Generates a grayscale image of the largest channel difference of each pixel.
+     *
+     * @param gain Multiplier applied to the difference, to make small errors visible.
+     */
+    [[nodiscard]] ::Image GenHeatmap(float gain = 1.0f) const {
+        ::Image heatmap = ::GenImageColor(width, height, {0, 0, 0, 255});
+        ::ImageFormat(&heatmap, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+        auto* output = static_cast<unsigned char*>(heatmap.data);
+
+        const size_t count = GetPixelCount();
+        for (size_t i = 0; i < count; i++) {
+            const ::Color& a = expectedPixels[i];
+            const ::Color& b = actualPixels[i];
+            int error = std::abs(a.r - b.r);
+            error = std::max(error, std::abs(a.g - b.g));
+            error = std::max(error, std::abs(a.b - b.b));
+            error = std::max(error, std::abs(a.a - b.a));
+            const float value = static_cast<float>(error) * gain;
+            output[i] = static_cast<unsigned char>(value < 255.0f ? value : 255.0f);
+        }
+        return heatmap;
+    }
+protected:
+    /** Pixels per block, small enough to keep the 32-bit SIMD accumulators from overflowing */
+    static constexpr size_t blockSize = 8192;
+    static constexpr size_t earlyExitBlockSize = 1024;
+    static constexpr int ssimWindow = 8;
+    static constexpr int ssimStride = 4;
+
+    struct Accumulator {
+        std::array<uint64_t, 4> sum{};
+        std::array<uint64_t, 4> squared{};
+        std::array<unsigned char, 4> max{};
+        size_t different{0};
+    };
+
+    [[nodiscard]] size_t GetPixelCount() const { return static_cast<size_t>(width) * static_cast<size_t>(height); }
+
+    /**
+     * Returns the RGBA8 pixels of the image, converting into the given copy when needed.
+     */
+    static const ::Color* Prepare(const ::Image& image, Image& copy) {
+        if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+            return static_cast<const ::Color*>(image.data);
+        }
+        if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) {
+            throw RaylibException("Failed to compare images: compressed formats are not supported");
+        }
+
+        copy = ::ImageCopy(image);
+        copy.Format(PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        return static_cast<const ::Color*>(copy.data);
+    }
+
+    /**
+     * Adds the absolute differences of at most blockSize pixels to the accumulator.
+     */
+    static void Accumulate(
+        const ::Color* expected,
+        const ::Color* actual,
+        size_t count,
+        unsigned char tolerance,
+        Accumulator& total) {
+        size_t i = 0;
+#ifdef RAYLIB_CPP_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i lowByte = _mm_set1_epi32(0xFF);
+        const __m128i toleranceVector = _mm_set1_epi8(static_cast<char>(tolerance));
+        __m128i maxVector = zero;
+        __m128i sumVector[4] = {zero, zero, zero, zero};
+        __m128i squaredVector[4] = {zero, zero, zero, zero};
+        for (; i + 4 <= count; i += 4) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(expected + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(actual + i));
+            const __m128i difference = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+            maxVector = _mm_max_epu8(maxVector, difference);
+
+            // A pixel differs when any of its bytes is still non-zero after subtracting the tolerance.
+            const __m128i equal = _mm_cmpeq_epi32(_mm_subs_epu8(difference, toleranceVector), zero);
+            total.different += static_cast<size_t>(4 - std::popcount(static_cast<unsigned int>(
+                _mm_movemask_ps(_mm_castsi128_ps(equal)))));
+
+            for (int channel = 0; channel < 4; channel++) {
+                const __m128i value = _mm_and_si128(_mm_srli_epi32(difference, channel * 8), lowByte);
+                sumVector[channel] = _mm_add_epi32(sumVector[channel], value);
+                squaredVector[channel] = _mm_add_epi32(squaredVector[channel], _mm_madd_epi16(value, value));
+            }
+        }
+
+        alignas(16) std::array<unsigned char, 16> maxBytes{};
+        _mm_store_si128(reinterpret_cast<__m128i*>(maxBytes.data()), maxVector);
+        for (size_t channel = 0; channel < 4; channel++) {
+            alignas(16) std::array<uint32_t, 4> sums{};
+            alignas(16) std::array<uint32_t, 4> squares{};
+            _mm_store_si128(reinterpret_cast<__m128i*>(sums.data()), sumVector[channel]);
+            _mm_store_si128(reinterpret_cast<__m128i*>(squares.data()), squaredVector[channel]);
+            for (size_t lane = 0; lane < 4; lane++) {
+                total.sum[channel] += sums[lane];
+                total.squared[channel] += squares[lane];
+                total.max[channel] = std::max(total.max[channel], maxBytes[lane * 4 + channel]);
+            }
+        }
+#endif
+        for (; i < count; i++) {
+            const std::array<int, 4> difference{
+                std::abs(expected[i].r - actual[i].r),
+                std::abs(expected[i].g - actual[i].g),
+                std::abs(expected[i].b - actual[i].b),
+                std::abs(expected[i].a - actual[i].a)};
+            bool different = false;
+            for (size_t channel = 0; channel < 4; channel++) {
+                const auto value = static_cast<unsigned int>(difference[channel]);
+                total.sum[channel] += value;
+                total.squared[channel] += value * value;
+                total.max[channel] = std::max(total.max[channel], static_cast<unsigned char>(value));
+                different = different || value > tolerance;
+            }
+            total.different += different ? 1 : 0;
+        }
+    }
+
+    /**
+     * Rec. 601 luma of each pixel.
+     */
+    [[nodiscard]] std::vector<float> LoadLuma(const ::Color* pixels) const {
+        std::vector<float> luma(GetPixelCount());
+        for (size_t i = 0; i < luma.size(); i++) {
+            luma[i] = 0.299f * pixels[i].r + 0.587f * pixels[i].g + 0.114f * pixels[i].b;
+        }
+        return luma;
+    }
+
+    int width;
+    int height;
+    Image expectedCopy;
+    Image actualCopy;
+    const ::Color* expectedPixels{nullptr};
+    const ::Color* actualPixels{nullptr};
+};
+} // namespace raylib
+
+using RImageCompare = raylib::ImageCompare;
+
+#endif // RAYLIB_CPP_INCLUDE_IMAGECOMPARE_HPP_
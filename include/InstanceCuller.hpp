@@ -0,0 +1,247 @@
+#ifndef RAYLIB_CPP_INCLUDE_INSTANCECULLER_HPP_
+#define RAYLIB_CPP_INCLUDE_INSTANCECULLER_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "./Frustum.hpp"
+#include "./ThreadPool.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+#ifdef RAYLIB_CPP_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace raylib {
+/**
+ * Frustum culling for instanced drawing, keeping only the instances whose transformed bounds can be seen.
+ *
+ * Each instance is tested as the oriented box its transform makes of the local bounds, four instances at a time
+ * against each plane. The visible transforms are packed into a buffer reused between frames, and large batches are
+ * split over a ThreadPool.
+ *
+ * @code
+ * raylib::InstanceCuller culler;
+ * culler.Draw(tree, material, raylib::Frustum(camera, aspect), tree.BoundingBox(), forest);
+ * @endcode
+ */
+class InstanceCuller {
+public:
+    explicit InstanceCuller(ThreadPool& pool = ThreadPool::GetDefault()) : pool(&pool) {}
+
+    InstanceCuller(const InstanceCuller&) = default;
+    InstanceCuller& operator=(const InstanceCuller&) = default;
+    InstanceCuller(InstanceCuller&& other) = default;
+    InstanceCuller& operator=(InstanceCuller&& other) = default;
+
+    /**
+     * Pack the transforms of the instances whose bounds intersect the frustum, in their original order.
+     *
+     * @param bounds Bounds of the mesh in its own space, i.e. Mesh::BoundingBox().
+     * @return The visible transforms, valid until the next call.
+     */
+    std::span<const ::Matrix> Cull(
+        const Frustum& frustum,
+        const ::BoundingBox& bounds,
+        std::span<const ::Matrix> transforms) {
+        Plane planes[6];
+        for (int i = 0; i < 6; i++) {
+            const ::Vector4& plane = frustum.GetPlane(static_cast<Frustum::Plane>(i));
+            planes[i] = {plane.x, plane.y, plane.z, plane.w};
+        }
+        const Box box{
+            {(bounds.min.x + bounds.max.x) * 0.5f,
+             (bounds.min.y + bounds.max.y) * 0.5f,
+             (bounds.min.z + bounds.max.z) * 0.5f},
+            {(bounds.max.x - bounds.min.x) * 0.5f,
+             (bounds.max.y - bounds.min.y) * 0.5f,
+             (bounds.max.z - bounds.min.z) * 0.5f}};
+
+        if (visible.size() < transforms.size()) {
+            visible.resize(transforms.size());
+        }
+        const size_t chunks = (transforms.size() + instancesPerTask - 1) / instancesPerTask;
+        chunkCounts.assign(chunks, 0);
+
+        // Every chunk packs its survivors at its own offset, then the chunks are closed up in order
+        pool->ParallelFor(chunks, 1, [&](size_t first, size_t last) {
+            for (size_t chunk = first; chunk < last; chunk++) {
+                const size_t begin = chunk * instancesPerTask;
+                const size_t count = std::min(instancesPerTask, transforms.size() - begin);
+                chunkCounts[chunk] = CullRange(planes, box, transforms.data() + begin, count, visible.data() + begin);
+            }
+        });
+
+        visibleCount = 0;
+        for (size_t chunk = 0; chunk < chunks; chunk++) {
+            const auto source = visible.begin() + static_cast<std::ptrdiff_t>(chunk * instancesPerTask);
+            std::copy(
+                source,
+                source + static_cast<std::ptrdiff_t>(chunkCounts[chunk]),
+                visible.begin() + static_cast<std::ptrdiff_t>(visibleCount));
+            visibleCount += chunkCounts[chunk];
+        }
+        culledCount = transforms.size() - visibleCount;
+        return GetVisible();
+    }
+
+    /**
+     * Cull the instances, then draw the visible ones with a single instanced draw call.
+     */
+    void Draw(
+        const ::Mesh& mesh,
+        const ::Material& material,
+        const Frustum& frustum,
+        const ::BoundingBox& bounds,
+        std::span<const ::Matrix> transforms) {
+        const std::span<const ::Matrix> survivors = Cull(frustum, bounds, transforms);
+        if (!survivors.empty()) {
+            ::DrawMeshInstanced(mesh, material, survivors.data(), static_cast<int>(survivors.size()));
+        }
+    }
+
+    /**
+     * Transforms that survived the last Cull()
+     */
+    [[nodiscard]] std::span<const ::Matrix> GetVisible() const { return {visible.data(), visibleCount}; }
+
+    [[nodiscard]] size_t GetVisibleCount() const { return visibleCount; }
+
+    /** Instances rejected by the last Cull() */
+    [[nodiscard]] size_t GetCulledCount() const { return culledCount; }
+protected:
+    struct Plane {
+        float x{0.0f};
+        float y{0.0f};
+        float z{0.0f};
+        float d{0.0f};
+    };
+
+    struct Box {
+        ::Vector3 center{};
+        ::Vector3 extents{};
+    };
+
+    static constexpr size_t instancesPerTask = 4096;
+
+    /**
+     * Pack the visible transforms of a range into out, which may not overlap it, and return how many there are.
+     */
+    static size_t CullRange(
+        const Plane* planes,
+        const Box& box,
+        const ::Matrix* transforms,
+        size_t count,
+        ::Matrix* out) {
+        size_t written = 0;
+        size_t i = 0;
+#ifdef RAYLIB_CPP_SSE2
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+        const __m128 zero = _mm_setzero_ps();
+        for (; i + 4 <= count; i += 4) {
+            // raylib matrices store their rows contiguously, transposing four rows gives a column per matrix element
+            const auto* m = reinterpret_cast<const float*>(transforms + i);
+            __m128 m0 = _mm_loadu_ps(m);
+            __m128 m4 = _mm_loadu_ps(m + 16);
+            __m128 m8 = _mm_loadu_ps(m + 32);
+            __m128 m12 = _mm_loadu_ps(m + 48);
+            _MM_TRANSPOSE4_PS(m0, m4, m8, m12);
+            __m128 m1 = _mm_loadu_ps(m + 4);
+            __m128 m5 = _mm_loadu_ps(m + 20);
+            __m128 m9 = _mm_loadu_ps(m + 36);
+            __m128 m13 = _mm_loadu_ps(m + 52);
+            _MM_TRANSPOSE4_PS(m1, m5, m9, m13);
+            __m128 m2 = _mm_loadu_ps(m + 8);
+            __m128 m6 = _mm_loadu_ps(m + 24);
+            __m128 m10 = _mm_loadu_ps(m + 40);
+            __m128 m14 = _mm_loadu_ps(m + 56);
+            _MM_TRANSPOSE4_PS(m2, m6, m10, m14);
+
+            const __m128 cx = _mm_set1_ps(box.center.x);
+            const __m128 cy = _mm_set1_ps(box.center.y);
+            const __m128 cz = _mm_set1_ps(box.center.z);
+            const __m128 centerX =
+                _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, cx), _mm_mul_ps(m4, cy)), _mm_add_ps(_mm_mul_ps(m8, cz), m12));
+            const __m128 centerY =
+                _mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, cx), _mm_mul_ps(m5, cy)), _mm_add_ps(_mm_mul_ps(m9, cz), m13));
+            const __m128 centerZ =
+                _mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, cx), _mm_mul_ps(m6, cy)), _mm_add_ps(_mm_mul_ps(m10, cz), m14));
+            const __m128 ex = _mm_set1_ps(box.extents.x);
+            const __m128 ey = _mm_set1_ps(box.extents.y);
+            const __m128 ez = _mm_set1_ps(box.extents.z);
+
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (int p = 0; p < 6; p++) {
+                const __m128 nx = _mm_set1_ps(planes[p].x);
+                const __m128 ny = _mm_set1_ps(planes[p].y);
+                const __m128 nz = _mm_set1_ps(planes[p].z);
+                // Projected radius of the oriented box onto the plane normal
+                const __m128 alongX =
+                    _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, m0), _mm_mul_ps(ny, m1)), _mm_mul_ps(nz, m2));
+                const __m128 alongY =
+                    _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, m4), _mm_mul_ps(ny, m5)), _mm_mul_ps(nz, m6));
+                const __m128 alongZ =
+                    _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, m8), _mm_mul_ps(ny, m9)), _mm_mul_ps(nz, m10));
+                const __m128 radius = _mm_add_ps(
+                    _mm_add_ps(
+                        _mm_mul_ps(ex, _mm_and_ps(alongX, absMask)),
+                        _mm_mul_ps(ey, _mm_and_ps(alongY, absMask))),
+                    _mm_mul_ps(ez, _mm_and_ps(alongZ, absMask)));
+                const __m128 distance = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(nx, centerX), _mm_mul_ps(ny, centerY)),
+                    _mm_add_ps(_mm_mul_ps(nz, centerZ), _mm_set1_ps(planes[p].d)));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(distance, radius), zero));
+                if (_mm_movemask_ps(inside) == 0) {
+                    break;
+                }
+            }
+
+            const int mask = _mm_movemask_ps(inside);
+            for (size_t lane = 0; lane < 4; lane++) {
+                if ((mask & (1 << lane)) != 0) {
+                    out[written++] = transforms[i + lane];
+                }
+            }
+        }
+#endif
+        for (; i < count; i++) {
+            if (IsVisible(planes, box, transforms[i])) {
+                out[written++] = transforms[i];
+            }
+        }
+        return written;
+    }
+
+    static bool IsVisible(const Plane* planes, const Box& box, const ::Matrix& m) {
+        const ::Vector3 c = box.center;
+        const ::Vector3 center{
+            m.m0 * c.x + m.m4 * c.y + m.m8 * c.z + m.m12,
+            m.m1 * c.x + m.m5 * c.y + m.m9 * c.z + m.m13,
+            m.m2 * c.x + m.m6 * c.y + m.m10 * c.z + m.m14};
+        for (int p = 0; p < 6; p++) {
+            const Plane& n = planes[p];
+            const float radius = box.extents.x * std::fabs(n.x * m.m0 + n.y * m.m1 + n.z * m.m2) +
+                                 box.extents.y * std::fabs(n.x * m.m4 + n.y * m.m5 + n.z * m.m6) +
+                                 box.extents.z * std::fabs(n.x * m.m8 + n.y * m.m9 + n.z * m.m10);
+            if (n.x * center.x + n.y * center.y + n.z * center.z + n.d + radius < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    ThreadPool* pool{nullptr};
+    std::vector<::Matrix> visible{};
+    std::vector<size_t> chunkCounts{};
+    size_t visibleCount{0};
+    size_t culledCount{0};
+};
+} // namespace raylib
+
+using RInstanceCuller = raylib::InstanceCuller;
+
+#endif // RAYLIB_CPP_INCLUDE_INSTANCECULLER_HPP_
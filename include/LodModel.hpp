@@ -0,0 +1,274 @@
+#ifndef RAYLIB_CPP_INCLUDE_LODMODEL_HPP_
+#define RAYLIB_CPP_INCLUDE_LODMODEL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "./MeshOptimizer.hpp"
+#include "./Model.hpp"
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Model with several levels of detail, picking one by its projected size on screen.
+ *
+ * @code
+ * raylib::LodModel trees = raylib::LodModel::Generate(treeMesh, 4);
+ * ...
+ * for (Tree& tree : forest) {
+ *     tree.level = trees.Draw(camera, tree.position, 1.0f, WHITE, tree.level);
+ * }
+ * @endcode
+ */
+class LodModel {
+public:
+    LodModel() = default;
+
+    LodModel(const LodModel&) = delete;
+    LodModel& operator=(const LodModel&) = delete;
+
+    LodModel(LodModel&& other) = default;
+    LodModel& operator=(LodModel&& other) = default;
+
+    /**
+     * Generate levels from a mesh with MeshOptimizer::Simplify(), each with reduction times the triangles of the
+     * previous one, and upload them.
+     *
+     * The mesh data is copied, so the mesh stays untouched. Level k is drawn while the model covers at least
+     * screenSize * sqrt(reduction)^k of the screen height, which keeps about the same triangle density on screen.
+     *
+     * @param maxError Largest allowed distance to the original surface, relative to the size of the mesh.
+     */
+    static LodModel Generate(
+        const ::Mesh& mesh,
+        int levelCount = 4,
+        float reduction = 0.5f,
+        float maxError = 0.02f,
+        float screenSize = 0.5f) {
+        if (levelCount < 1 || reduction <= 0.0f || reduction >= 1.0f) {
+            throw RaylibException("LodModel requires at least one level and a reduction between 0 and 1");
+        }
+
+        LodModel model;
+        for (int level = 0; level < levelCount; level++) {
+            ::Mesh copy = CopyMesh(mesh);
+            if (level > 0) {
+                MeshOptimizer::Simplify(copy, std::pow(reduction, static_cast<float>(level)), maxError);
+            }
+            ::UploadMesh(&copy, false);
+            const float levelScreenSize = screenSize * std::pow(std::sqrt(reduction), static_cast<float>(level));
+            model.AddLevel(raylib::Model(copy), levelScreenSize);
+        }
+        return model;
+    }
+
+    /**
+     * Add a level, drawn while the model covers at least screenSize of the screen height.
+     *
+     * The bounds of the first level added are used to measure the projected size of every level.
+     */
+    LodModel& AddLevel(raylib::Model&& model, float screenSize) {
+        if (levels.empty()) {
+            const ::BoundingBox box = model.GetBoundingBox();
+            center = {
+                (box.min.x + box.max.x) * 0.5f,
+                (box.min.y + box.max.y) * 0.5f,
+                (box.min.z + box.max.z) * 0.5f};
+            const float x = box.max.x - center.x;
+            const float y = box.max.y - center.y;
+            const float z = box.max.z - center.z;
+            radius = std::sqrt(x * x + y * y + z * z);
+        }
+
+        Level level;
+        level.model = std::move(model);
+        level.screenSize = screenSize;
+        for (int i = 0; i < level.model.meshCount; i++) {
+            level.triangleCount += static_cast<size_t>(level.model.meshes[i].triangleCount);
+        }
+
+        // Most detailed, i.e. largest screen size, first
+        const auto position = std::find_if(levels.begin(), levels.end(), [screenSize](const Level& other) {
+            return other.screenSize < screenSize;
+        });
+        levels.insert(position, std::move(level));
+        lastLevel = -1;
+        return *this;
+    }
+
+    [[nodiscard]] int GetLevelCount() const { return static_cast<int>(levels.size()); }
+
+    [[nodiscard]] raylib::Model& GetModel(int level) { return levels.at(static_cast<size_t>(level)).model; }
+
+    [[nodiscard]] float GetLevelScreenSize(int level) const {
+        return levels.at(static_cast<size_t>(level)).screenSize;
+    }
+
+    [[nodiscard]] size_t GetTriangleCount(int level) const {
+        return levels.at(static_cast<size_t>(level)).triangleCount;
+    }
+
+    /**
+     * Fraction of a level's screen size threshold by which SelectLevel() lets a previous level overstay.
+     */
+    GETTERSETTER(float, Hysteresis, hysteresis)
+
+    /**
+     * Projected diameter of the bounding sphere, as a fraction of the screen height.
+     */
+    [[nodiscard]] float GetScreenSize(const ::Camera3D& camera, ::Vector3 position, float scale = 1.0f) const {
+        const float scaledRadius = radius * scale;
+        if (camera.projection == CAMERA_ORTHOGRAPHIC) {
+            return camera.fovy > 0.0f ? 2.0f * scaledRadius / camera.fovy : 0.0f;
+        }
+
+        const float x = position.x + center.x * scale - camera.position.x;
+        const float y = position.y + center.y * scale - camera.position.y;
+        const float z = position.z + center.z * scale - camera.position.z;
+        const float distance = std::sqrt(x * x + y * y + z * z);
+        if (distance <= scaledRadius) {
+            return 1.0f;
+        }
+        return scaledRadius / (distance * std::tan(camera.fovy * 0.5f * DEG2RAD));
+    }
+
+    /**
+     * Index of the level to draw, -1 when there are no levels.
+     *
+     * @param previous Level last drawn for the same object, or -1. It is kept until the screen size leaves its range
+     * by more than the hysteresis, so objects near a threshold do not flicker between two levels.
+     */
+    [[nodiscard]] int SelectLevel(
+        const ::Camera3D& camera,
+        ::Vector3 position,
+        float scale = 1.0f,
+        int previous = -1) const {
+        if (levels.empty()) {
+            return -1;
+        }
+
+        const float screenSize = GetScreenSize(camera, position, scale);
+        if (previous >= 0 && previous < static_cast<int>(levels.size())) {
+            const auto current = static_cast<size_t>(previous);
+            const bool coarser =
+                current + 1 < levels.size() && screenSize < levels[current].screenSize * (1.0f - hysteresis);
+            const bool finer = current > 0 && screenSize >= levels[current - 1].screenSize * (1.0f + hysteresis);
+            if (!coarser && !finer) {
+                return previous;
+            }
+        }
+        for (size_t i = 0; i < levels.size(); i++) {
+            if (screenSize >= levels[i].screenSize) {
+                return static_cast<int>(i);
+            }
+        }
+        return static_cast<int>(levels.size()) - 1;
+    }
+
+    /**
+     * Select the level for the camera with SelectLevel(), keeping the level selected by the last call within the
+     * hysteresis.
+     */
+    int UpdateLevel(const ::Camera3D& camera, ::Vector3 position, float scale = 1.0f) {
+        lastLevel = SelectLevel(camera, position, scale, lastLevel);
+        return lastLevel;
+    }
+
+    /**
+     * Level selected by the last UpdateLevel() or Draw(), -1 before the first.
+     */
+    [[nodiscard]] int GetLastLevel() const { return lastLevel; }
+
+    /**
+     * Draw the level selected for the camera, with the hysteresis applied to the level drawn by the last call.
+     *
+     * A model drawn at several positions should pass the previous level of each through the other overload.
+     */
+    void Draw(
+        const ::Camera3D& camera,
+        ::Vector3 position,
+        float scale = 1.0f,
+        ::Color tint = {255, 255, 255, 255}) {
+        DrawLevel(UpdateLevel(camera, position, scale), position, scale, tint);
+    }
+
+    /**
+     * Draw the level selected for the camera, with the hysteresis applied to the previous level of this instance.
+     *
+     * @return The level drawn, to pass as previous on the next frame.
+     */
+    int Draw(const ::Camera3D& camera, ::Vector3 position, float scale, ::Color tint, int previous) {
+        const int level = SelectLevel(camera, position, scale, previous);
+        DrawLevel(level, position, scale, tint);
+        return level;
+    }
+
+    /**
+     * Triangles drawn by Draw() since the last ResetDrawnTriangleCount(), to measure the savings.
+     */
+    [[nodiscard]] size_t GetDrawnTriangleCount() const { return drawnTriangleCount; }
+
+    void ResetDrawnTriangleCount() { drawnTriangleCount = 0; }
+protected:
+    struct Level {
+        raylib::Model model{};
+        float screenSize{0.0f};
+        size_t triangleCount{0};
+    };
+
+    void DrawLevel(int level, ::Vector3 position, float scale, ::Color tint) {
+        if (level < 0) {
+            return;
+        }
+
+        const Level& selected = levels[static_cast<size_t>(level)];
+        selected.model.Draw(position, scale, tint);
+        drawnTriangleCount += selected.triangleCount;
+    }
+
+    /**
+     * Copy of the vertex data in RAM, without the GPU buffers.
+     */
+    static ::Mesh CopyMesh(const ::Mesh& mesh) {
+        const auto copy = [](auto* data, size_t count) {
+            using Type = std::remove_pointer_t<decltype(data)>;
+            if (data == nullptr) {
+                return static_cast<Type*>(nullptr);
+            }
+            auto* result = static_cast<Type*>(RL_MALLOC(count * sizeof(Type)));
+            memcpy(result, data, count * sizeof(Type));
+            return result;
+        };
+
+        const auto vertexCount = static_cast<size_t>(mesh.vertexCount);
+        ::Mesh result{};
+        result.vertexCount = mesh.vertexCount;
+        result.triangleCount = mesh.triangleCount;
+        result.vertices = copy(mesh.vertices, vertexCount * 3);
+        result.texcoords = copy(mesh.texcoords, vertexCount * 2);
+        result.texcoords2 = copy(mesh.texcoords2, vertexCount * 2);
+        result.normals = copy(mesh.normals, vertexCount * 3);
+        result.tangents = copy(mesh.tangents, vertexCount * 4);
+        result.colors = copy(mesh.colors, vertexCount * 4);
+        result.indices = copy(mesh.indices, static_cast<size_t>(mesh.triangleCount) * 3);
+        return result;
+    }
+
+    std::vector<Level> levels{};
+    ::Vector3 center{0.0f, 0.0f, 0.0f};
+    float radius{0.0f};
+    float hysteresis{0.1f};
+    int lastLevel{-1};
+    size_t drawnTriangleCount{0};
+};
+} // namespace raylib
+
+using RLodModel = raylib::LodModel;
+
+#endif // RAYLIB_CPP_INCLUDE_LODMODEL_HPP_
@@ -0,0 +1,148 @@
+#ifndef RAYLIB_CPP_INCLUDE_MAPPEDFILE_HPP_
+#define RAYLIB_CPP_INCLUDE_MAPPEDFILE_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define RAYLIB_CPP_MMAP
+#endif
+
+namespace raylib {
+/**
+ * File mapped into memory copy-on-write, so it can be read in place and patched without touching the file.
+ *
+ * Uses mmap() where available and reads the whole file otherwise, both giving a 16 byte aligned start.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    /**
+     * @throws raylib::RaylibException Throws if the file could not be opened or mapped.
+     */
+    explicit MappedFile(const std::string_view fileName) { Load(fileName); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : data(other.data),
+          size(other.size),
+          mapped(other.mapped),
+          buffer(std::move(other.buffer)) {
+        other.data = nullptr;
+        other.size = 0;
+        other.mapped = false;
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Unload();
+            data = other.data;
+            size = other.size;
+            mapped = other.mapped;
+            buffer = std::move(other.buffer);
+            other.data = nullptr;
+            other.size = 0;
+            other.mapped = false;
+        }
+        return *this;
+    }
+
+    ~MappedFile() { Unload(); }
+
+    /**
+     * @throws raylib::RaylibException Throws if the file could not be opened or mapped.
+     */
+    void Load(const std::string_view fileName) {
+        Unload();
+        const std::string path(fileName);
+#ifdef RAYLIB_CPP_MMAP
+        const int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            throw RaylibException("Failed to open " + path);
+        }
+        struct stat status {};
+        if (::fstat(descriptor, &status) != 0) {
+            ::close(descriptor);
+            throw RaylibException("Failed to read the size of " + path);
+        }
+        size = static_cast<size_t>(status.st_size);
+        if (size > 0) {
+            void* view = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0);
+            if (view == MAP_FAILED) {
+                ::close(descriptor);
+                size = 0;
+                throw RaylibException("Failed to map " + path);
+            }
+            data = static_cast<unsigned char*>(view);
+            mapped = true;
+        }
+        ::close(descriptor);
+#else
+        int bytesRead = 0;
+        unsigned char* fileData = ::LoadFileData(path.c_str(), &bytesRead);
+        if (fileData == nullptr) {
+            throw RaylibException("Failed to open " + path);
+        }
+        size = static_cast<size_t>(bytesRead);
+        buffer.resize((size + sizeof(Block) - 1) / sizeof(Block));
+        data = reinterpret_cast<unsigned char*>(buffer.data());
+        memcpy(data, fileData, size);
+        ::UnloadFileData(fileData);
+#endif
+    }
+
+    void Unload() {
+#ifdef RAYLIB_CPP_MMAP
+        if (mapped) {
+            ::munmap(data, size);
+        }
+#endif
+        buffer.clear();
+        data = nullptr;
+        size = 0;
+        mapped = false;
+    }
+
+    [[nodiscard]] unsigned char* GetData() const { return data; }
+
+    [[nodiscard]] size_t GetSize() const { return size; }
+
+    [[nodiscard]] std::span<unsigned char> GetSpan() const { return {data, size}; }
+
+    /**
+     * Whether the file is mapped rather than read into memory.
+     */
+    [[nodiscard]] bool IsMapped() const { return mapped; }
+
+    [[nodiscard]] bool IsValid() const { return data != nullptr; }
+protected:
+    struct alignas(16) Block {
+        unsigned char bytes[16];
+    };
+
+    unsigned char* data{nullptr};
+    size_t size{0};
+    bool mapped{false};
+    std::vector<Block> buffer{};
+};
+} // namespace raylib
+
+using RMappedFile = raylib::MappedFile;
+
+#endif // RAYLIB_CPP_INCLUDE_MAPPEDFILE_HPP_
@@ -0,0 +1,76 @@
+#ifndef RAYLIB_CPP_INCLUDE_MAPPEDMODEL_HPP_
+#define RAYLIB_CPP_INCLUDE_MAPPEDMODEL_HPP_
+
+#include <string_view>
+#include <utility>
+
+#include "./MappedFile.hpp"
+#include "./Model.hpp"
+#include "./ModelBinary.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Model whose mesh attributes point straight into a mapped raylib-cpp binary file, without copying them.
+ *
+ * The mapping is copy-on-write, so the attributes may be edited in place, but never replace or free them, i.e. with
+ * MeshOptimizer. Always unload through this class rather than through a raylib::Model reference.
+ *
+ * @see raylib::ModelBinary
+ */
+class MappedModel : public Model {
+public:
+    MappedModel() = default;
+
+    /**
+     * @throws raylib::RaylibException Throws if the file is missing, truncated or of another version.
+     */
+    explicit MappedModel(const std::string_view fileName, bool upload = true) { Load(fileName, upload); }
+
+    MappedModel(const MappedModel&) = delete;
+    MappedModel& operator=(const MappedModel&) = delete;
+
+    MappedModel(MappedModel&& other) noexcept = default;
+
+    MappedModel& operator=(MappedModel&& other) noexcept {
+        if (this != &other) {
+            Unload();
+            Model::operator=(std::move(other));
+            file = std::move(other.file);
+        }
+        return *this;
+    }
+
+    ~MappedModel() { ModelBinary::Detach(*this); }
+
+    /**
+     * @throws raylib::RaylibException Throws if the file is missing, truncated or of another version.
+     */
+    void Load(const std::string_view fileName, bool upload = true) {
+        Unload();
+        file.Load(fileName);
+        set(ModelBinary::Load(file, false, false, upload));
+    }
+
+    /**
+     * Unload the model, leaving the attributes in the file alone, then unmap the file.
+     */
+    void Unload() {
+        ModelBinary::Detach(*this);
+        Model::Unload();
+        file.Unload();
+    }
+
+    /**
+     * Whether the file is mapped rather than read into memory, which depends on the platform.
+     */
+    [[nodiscard]] bool IsMapped() const { return file.IsMapped(); }
+protected:
+    MappedFile file{};
+};
+} // namespace raylib
+
+using RMappedModel = raylib::MappedModel;
+
+#endif // RAYLIB_CPP_INCLUDE_MAPPEDMODEL_HPP_
@@ -8,6 +8,7 @@
 #include "./raylib.hpp"
 #include "./raylib-cpp-utils.hpp"
 #include "./BoundingBox.hpp"
+#include "./BoundingSphere.hpp"
 #include "./MeshUnmanaged.hpp"
 #include "./Vector3.hpp"
 // #include "./Model.hpp"
@@ -39,6 +40,7 @@ public:
      */
     Mesh(Mesh&& other) noexcept {
         set(other);
+        setBounds(other);
 
         other.vertexCount = 0;
         other.triangleCount = 0;
@@ -64,6 +66,7 @@ public:
 
         Unload();
         set(other);
+        setBounds(other);
 
         other.vertexCount = 0;
         other.triangleCount = 0;
@@ -0,0 +1,877 @@
+#ifndef RAYLIB_CPP_INCLUDE_MESHBVH_HPP_
+#define RAYLIB_CPP_INCLUDE_MESHBVH_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "./RaylibException.hpp"
+#include "./ThreadPool.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+#ifdef RAYLIB_CPP_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace raylib {
+/**
+ * Bounding volume hierarchy over the triangles of a mesh, for ray casts and overlap tests in logarithmic time.
+ *
+ * Built top down with binned surface area heuristic splits, the two halves of large nodes built in parallel on a
+ * ThreadPool. Queries are in mesh space unless a transform is passed, and report the same distances, points and
+ * normals as ::GetRayCollisionMesh(). The BVH keeps its own copy of the triangles, rebuild it after editing the mesh.
+ *
+ * @code
+ * raylib::MeshBVH bvh(level.meshes[0]);
+ * raylib::RayCollision hit = bvh.GetCollision(GetScreenToWorldRay(GetMousePosition(), camera), level.transform);
+ * @endcode
+ */
+class MeshBVH {
+public:
+    explicit MeshBVH(ThreadPool& pool = ThreadPool::GetDefault()) : pool(&pool) {}
+
+    /**
+     * @throws raylib::RaylibException Throws if the mesh has no vertices.
+     */
+    explicit MeshBVH(const ::Mesh& mesh, ThreadPool& pool = ThreadPool::GetDefault()) : pool(&pool) { Build(mesh); }
+
+    MeshBVH(const MeshBVH&) = default;
+    MeshBVH& operator=(const MeshBVH&) = default;
+    MeshBVH(MeshBVH&& other) = default;
+    MeshBVH& operator=(MeshBVH&& other) = default;
+
+    /**
+     * Build the hierarchy over the mesh's triangles, indexed or not.
+     *
+     * @throws raylib::RaylibException Throws if the mesh has no vertices.
+     */
+    void Build(const ::Mesh& mesh) {
+        if (mesh.vertices == nullptr || mesh.vertexCount <= 0) {
+            throw RaylibException("MeshBVH requires a mesh with vertices");
+        }
+        const auto count = static_cast<size_t>(mesh.indices != nullptr ? mesh.triangleCount : mesh.vertexCount / 3);
+        const auto vertex = [&mesh](size_t index) {
+            const float* v = mesh.vertices + 3 * index;
+            return ::Vector3{v[0], v[1], v[2]};
+        };
+        const auto corner = [&mesh, &vertex](size_t triangle, size_t i) {
+            return vertex(mesh.indices != nullptr ? mesh.indices[3 * triangle + i] : 3 * triangle + i);
+        };
+
+        BuildState state;
+        std::vector<Reference>& references = state.references;
+        references.resize(count);
+        pool->ParallelFor(count, trianglesPerTask, [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; i++) {
+                const ::Vector3 a = corner(i, 0);
+                const ::Vector3 b = corner(i, 1);
+                const ::Vector3 c = corner(i, 2);
+                Reference& reference = references[i];
+                reference.min = {std::min({a.x, b.x, c.x}), std::min({a.y, b.y, c.y}), std::min({a.z, b.z, c.z})};
+                reference.max = {std::max({a.x, b.x, c.x}), std::max({a.y, b.y, c.y}), std::max({a.z, b.z, c.z})};
+                reference.centroid = {
+                    (reference.min.x + reference.max.x) * 0.5f,
+                    (reference.min.y + reference.max.y) * 0.5f,
+                    (reference.min.z + reference.max.z) * 0.5f};
+                reference.triangle = static_cast<uint32_t>(i);
+            }
+        });
+
+        nodes.assign(count > 0 ? 2 * count - 1 : 1, Node());
+        if (count > 0) {
+            BuildNode(state, 0, 0, count, 1);
+        }
+        nodes.resize(state.nodeCount);
+        depth = state.depth;
+
+        // Triangles in leaf order, as an origin and two edges for the intersection test
+        triangles.resize(count);
+        triangleIds.resize(count);
+        pool->ParallelFor(count, trianglesPerTask, [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; i++) {
+                const uint32_t id = references[i].triangle;
+                const ::Vector3 a = corner(id, 0);
+                const ::Vector3 b = corner(id, 1);
+                const ::Vector3 c = corner(id, 2);
+                triangles[i] = {a, {b.x - a.x, b.y - a.y, b.z - a.z}, {c.x - a.x, c.y - a.y, c.z - a.z}};
+                triangleIds[i] = static_cast<int>(id);
+            }
+        });
+    }
+
+    /**
+     * Closest hit of the ray within maxDistance, in units of the ray direction's length.
+     *
+     * @param triangle Receives the index of the triangle hit, if not null.
+     */
+    [[nodiscard]] ::RayCollision GetCollision(
+        const ::Ray& ray,
+        float maxDistance = FLT_MAX,
+        int* triangle = nullptr) const {
+        const RayData data = Prepare(ray);
+        float distance = maxDistance;
+        const uint32_t hit = Traverse(data, distance, false);
+        if (hit == UINT32_MAX) {
+            return ::RayCollision{};
+        }
+        if (triangle != nullptr) {
+            *triangle = triangleIds[hit];
+        }
+        return MakeCollision(ray, distance, hit);
+    }
+
+    /**
+     * Closest hit of a world space ray with the mesh drawn with the transform.
+     */
+    [[nodiscard]] ::RayCollision GetCollision(
+        const ::Ray& ray,
+        const ::Matrix& transform,
+        float maxDistance = FLT_MAX,
+        int* triangle = nullptr) const {
+        const ::Matrix inverse = Invert(transform);
+        const ::Ray local{TransformPoint(inverse, ray.position), TransformDirection(inverse, ray.direction)};
+        ::RayCollision collision = GetCollision(local, maxDistance, triangle);
+        if (collision.hit) {
+            const ::Vector3 n = collision.normal;
+            const ::Matrix& m = inverse;
+            collision.point = {
+                ray.position.x + ray.direction.x * collision.distance,
+                ray.position.y + ray.direction.y * collision.distance,
+                ray.position.z + ray.direction.z * collision.distance};
+            // Normals transform by the inverse transpose
+            collision.normal = Normalize({
+                m.m0 * n.x + m.m1 * n.y + m.m2 * n.z,
+                m.m4 * n.x + m.m5 * n.y + m.m6 * n.z,
+                m.m8 * n.x + m.m9 * n.y + m.m10 * n.z});
+        }
+        return collision;
+    }
+
+    /**
+     * Whether the ray hits any triangle within maxDistance, stopping at the first hit found, i.e. for line of sight.
+     */
+    [[nodiscard]] bool CheckCollision(const ::Ray& ray, float maxDistance = FLT_MAX) const {
+        float distance = maxDistance;
+        return Traverse(Prepare(ray), distance, true) != UINT32_MAX;
+    }
+
+    /**
+     * Closest hits of many rays, four at a time with SSE2, spread over the ThreadPool.
+     *
+     * @throws raylib::RaylibException Throws if there are fewer results than rays.
+     */
+    void GetCollisions(
+        std::span<const ::Ray> rays,
+        std::span<::RayCollision> collisions,
+        float maxDistance = FLT_MAX) const {
+        if (collisions.size() < rays.size()) {
+            throw RaylibException("MeshBVH::GetCollisions() requires a result per ray");
+        }
+        const size_t packets = (rays.size() + 3) / 4;
+        pool->ParallelFor(packets, packetsPerTask, [&](size_t first, size_t last) {
+            for (size_t packet = first; packet < last; packet++) {
+                const size_t begin = packet * 4;
+                const size_t count = std::min<size_t>(4, rays.size() - begin);
+#ifdef RAYLIB_CPP_SSE2
+                TraversePacket(rays.data() + begin, count, maxDistance, collisions.data() + begin);
+#else
+                for (size_t i = begin; i < begin + count; i++) {
+                    collisions[i] = GetCollision(rays[i], maxDistance);
+                }
+#endif
+            }
+        });
+    }
+
+    /**
+     * Append the indices of the triangles that intersect the box.
+     *
+     * @return The number of triangles appended.
+     */
+    size_t GetOverlapping(const ::BoundingBox& box, std::vector<int>& result) const {
+        const ::Vector3 center{
+            (box.min.x + box.max.x) * 0.5f,
+            (box.min.y + box.max.y) * 0.5f,
+            (box.min.z + box.max.z) * 0.5f};
+        const ::Vector3 halfSize{
+            (box.max.x - box.min.x) * 0.5f,
+            (box.max.y - box.min.y) * 0.5f,
+            (box.max.z - box.min.z) * 0.5f};
+        return Overlap(
+            [&box](const Node& node) {
+                return node.min.x <= box.max.x && node.max.x >= box.min.x && node.min.y <= box.max.y &&
+                       node.max.y >= box.min.y && node.min.z <= box.max.z && node.max.z >= box.min.z;
+            },
+            [&center, &halfSize](const Triangle& triangle) { return TriangleOverlapsBox(triangle, center, halfSize); },
+            result);
+    }
+
+    /**
+     * Append the indices of the triangles that intersect the sphere.
+     *
+     * @return The number of triangles appended.
+     */
+    size_t GetOverlapping(::Vector3 center, float radius, std::vector<int>& result) const {
+        const float radiusSquared = radius * radius;
+        return Overlap(
+            [&center, radiusSquared](const Node& node) {
+                const float dx = std::max({node.min.x - center.x, 0.0f, center.x - node.max.x});
+                const float dy = std::max({node.min.y - center.y, 0.0f, center.y - node.max.y});
+                const float dz = std::max({node.min.z - center.z, 0.0f, center.z - node.max.z});
+                return dx * dx + dy * dy + dz * dz <= radiusSquared;
+            },
+            [&center, radiusSquared](const Triangle& triangle) {
+                const ::Vector3 point = ClosestPoint(triangle, center);
+                const float dx = point.x - center.x;
+                const float dy = point.y - center.y;
+                const float dz = point.z - center.z;
+                return dx * dx + dy * dy + dz * dz <= radiusSquared;
+            },
+            result);
+    }
+
+    /**
+     * Bounds of all triangles, in mesh space
+     */
+    [[nodiscard]] ::BoundingBox GetBounds() const {
+        return triangles.empty() ? ::BoundingBox{} : ::BoundingBox{nodes[0].min, nodes[0].max};
+    }
+
+    [[nodiscard]] size_t GetTriangleCount() const { return triangles.size(); }
+
+    [[nodiscard]] size_t GetNodeCount() const { return nodes.size(); }
+
+    /** Levels of the deepest leaf */
+    [[nodiscard]] int GetDepth() const { return depth; }
+protected:
+    /**
+     * Interior nodes have their two children next to each other, leaves a range of triangles.
+     */
+    struct Node {
+        ::Vector3 min{};
+        /** First triangle of a leaf, or the left child */
+        uint32_t first{0};
+        ::Vector3 max{};
+        /** Triangles of a leaf, 0 for interior nodes */
+        uint32_t count{0};
+    };
+
+    struct Triangle {
+        ::Vector3 origin{};
+        ::Vector3 edge1{};
+        ::Vector3 edge2{};
+    };
+
+    struct Reference {
+        ::Vector3 min{};
+        ::Vector3 max{};
+        ::Vector3 centroid{};
+        uint32_t triangle{0};
+    };
+
+    struct Bin {
+        ::Vector3 min{FLT_MAX, FLT_MAX, FLT_MAX};
+        ::Vector3 max{-FLT_MAX, -FLT_MAX, -FLT_MAX};
+        uint32_t count{0};
+    };
+
+    /**
+     * Triangles being sorted into the nodes, and the counters shared by the threads building them.
+     */
+    struct BuildState {
+        std::vector<Reference> references{};
+        std::atomic<uint32_t> nodeCount{1};
+        std::atomic<int> depth{0};
+    };
+
+    struct RayData {
+        ::Vector3 origin{};
+        ::Vector3 direction{};
+        ::Vector3 inverse{};
+    };
+
+    static constexpr int binCount = 16;
+    static constexpr uint32_t maxLeafSize = 8;
+    static constexpr int maxDepth = 64;
+    static constexpr size_t parallelBuildSize = 8192;
+    static constexpr size_t trianglesPerTask = 16384;
+    static constexpr size_t packetsPerTask = 16;
+    static constexpr float epsilon = 0.000001f;
+
+    static float Area(::Vector3 min, ::Vector3 max) {
+        const float x = max.x - min.x;
+        const float y = max.y - min.y;
+        const float z = max.z - min.z;
+        return x * y + y * z + z * x;
+    }
+
+    static float Axis(::Vector3 v, int axis) { return axis == 0 ? v.x : axis == 1 ? v.y : v.z; }
+
+    static void Grow(::Vector3& min, ::Vector3& max, ::Vector3 otherMin, ::Vector3 otherMax) {
+        min = {std::min(min.x, otherMin.x), std::min(min.y, otherMin.y), std::min(min.z, otherMin.z)};
+        max = {std::max(max.x, otherMax.x), std::max(max.y, otherMax.y), std::max(max.z, otherMax.z)};
+    }
+
+    void BuildNode(BuildState& state, uint32_t index, size_t first, size_t count, int level) {
+        std::vector<Reference>& references = state.references;
+        ::Vector3 min{FLT_MAX, FLT_MAX, FLT_MAX};
+        ::Vector3 max{-FLT_MAX, -FLT_MAX, -FLT_MAX};
+        ::Vector3 centroidMin = min;
+        ::Vector3 centroidMax = max;
+        for (size_t i = first; i < first + count; i++) {
+            Grow(min, max, references[i].min, references[i].max);
+            Grow(centroidMin, centroidMax, references[i].centroid, references[i].centroid);
+        }
+        Node& node = nodes[index];
+        node.min = min;
+        node.max = max;
+        node.first = static_cast<uint32_t>(first);
+        node.count = static_cast<uint32_t>(count);
+
+        int deepest = state.depth.load();
+        while (level > deepest && !state.depth.compare_exchange_weak(deepest, level)) {
+        }
+        if (count <= 2 || level >= maxDepth) {
+            return;
+        }
+
+        // Binned SAH over all three axes, the cost of a leaf being one triangle test per triangle
+        int bestAxis = -1;
+        int bestSplit = 0;
+        float bestCost = static_cast<float>(count) * Area(min, max);
+        for (int axis = 0; axis < 3; axis++) {
+            const float low = Axis(centroidMin, axis);
+            const float extent = Axis(centroidMax, axis) - low;
+            if (extent <= 0.0f) {
+                continue;
+            }
+            Bin bins[binCount];
+            const float scale = static_cast<float>(binCount) / extent;
+            for (size_t i = first; i < first + count; i++) {
+                Bin& bin = bins[BinIndex(references[i].centroid, axis, low, scale)];
+                bin.count++;
+                Grow(bin.min, bin.max, references[i].min, references[i].max);
+            }
+
+            float rightArea[binCount];
+            uint32_t rightCount[binCount];
+            ::Vector3 boundsMin{FLT_MAX, FLT_MAX, FLT_MAX};
+            ::Vector3 boundsMax{-FLT_MAX, -FLT_MAX, -FLT_MAX};
+            uint32_t total = 0;
+            for (int b = binCount - 1; b > 0; b--) {
+                Grow(boundsMin, boundsMax, bins[b].min, bins[b].max);
+                total += bins[b].count;
+                rightCount[b] = total;
+                rightArea[b] = total > 0 ? Area(boundsMin, boundsMax) : 0.0f;
+            }
+            boundsMin = {FLT_MAX, FLT_MAX, FLT_MAX};
+            boundsMax = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+            total = 0;
+            for (int b = 1; b < binCount; b++) {
+                Grow(boundsMin, boundsMax, bins[b - 1].min, bins[b - 1].max);
+                total += bins[b - 1].count;
+                if (total == 0 || rightCount[b] == 0) {
+                    continue;
+                }
+                const float cost = Area(min, max) + static_cast<float>(total) * Area(boundsMin, boundsMax) +
+                                   static_cast<float>(rightCount[b]) * rightArea[b];
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = b;
+                }
+            }
+        }
+
+        const auto begin = references.begin() + static_cast<std::ptrdiff_t>(first);
+        const auto end = begin + static_cast<std::ptrdiff_t>(count);
+        auto middle = begin;
+        if (bestAxis >= 0) {
+            const float low = Axis(centroidMin, bestAxis);
+            const float scale = static_cast<float>(binCount) / (Axis(centroidMax, bestAxis) - low);
+            middle = std::partition(begin, end, [=](const Reference& reference) {
+                return BinIndex(reference.centroid, bestAxis, low, scale) < bestSplit;
+            });
+        } else if (count > maxLeafSize) {
+            // Too many triangles for a leaf but no useful split, i.e. identical centroids, so split the count
+            const ::Vector3 extent{centroidMax.x - centroidMin.x, centroidMax.y - centroidMin.y,
+                                   centroidMax.z - centroidMin.z};
+            const int axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : extent.y >= extent.z ? 1 : 2;
+            middle = begin + static_cast<std::ptrdiff_t>(count / 2);
+            std::nth_element(begin, middle, end, [axis](const Reference& a, const Reference& b) {
+                return Axis(a.centroid, axis) < Axis(b.centroid, axis);
+            });
+        } else {
+            return;
+        }
+
+        const auto leftCount = static_cast<size_t>(middle - begin);
+        const uint32_t left = state.nodeCount.fetch_add(2);
+        node.first = left;
+        node.count = 0;
+        if (count >= parallelBuildSize) {
+            pool->ParallelFor(2, 1, [&](size_t side, size_t) {
+                if (side == 0) {
+                    BuildNode(state, left, first, leftCount, level + 1);
+                } else {
+                    BuildNode(state, left + 1, first + leftCount, count - leftCount, level + 1);
+                }
+            });
+        } else {
+            BuildNode(state, left, first, leftCount, level + 1);
+            BuildNode(state, left + 1, first + leftCount, count - leftCount, level + 1);
+        }
+    }
+
+    static int BinIndex(::Vector3 centroid, int axis, float low, float scale) {
+        const auto bin = static_cast<int>((Axis(centroid, axis) - low) * scale);
+        return std::clamp(bin, 0, binCount - 1);
+    }
+
+    static RayData Prepare(const ::Ray& ray) {
+        const ::Vector3 d = ray.direction;
+        return {ray.position, d, {1.0f / d.x, 1.0f / d.y, 1.0f / d.z}};
+    }
+
+    /**
+     * Entry distance of the ray into the node, or FLT_MAX when it misses within maxDistance.
+     */
+    static float Enter(const Node& node, const RayData& ray, float maxDistance) {
+        float near = 0.0f;
+        float far = maxDistance;
+        const auto slab = [&near, &far](float min, float max, float origin, float inverse) {
+            const float t1 = (min - origin) * inverse;
+            const float t2 = (max - origin) * inverse;
+            // A ray running along a face of the node gives 0 * inf = NaN, and lies within that slab
+            if (!std::isnan(t1) && !std::isnan(t2)) {
+                near = std::max(near, std::min(t1, t2));
+                far = std::min(far, std::max(t1, t2));
+            }
+        };
+        slab(node.min.x, node.max.x, ray.origin.x, ray.inverse.x);
+        slab(node.min.y, node.max.y, ray.origin.y, ray.inverse.y);
+        slab(node.min.z, node.max.z, ray.origin.z, ray.inverse.z);
+        return near <= far ? near : FLT_MAX;
+    }
+
+    /**
+     * Möller-Trumbore intersection, two sided like ::GetRayCollisionTriangle()
+     */
+    static float Intersect(const Triangle& triangle, const RayData& ray) {
+        const ::Vector3 d = ray.direction;
+        const ::Vector3 e1 = triangle.edge1;
+        const ::Vector3 e2 = triangle.edge2;
+        const ::Vector3 p = Cross(d, e2);
+        const float determinant = Dot(e1, p);
+        if (determinant > -epsilon && determinant < epsilon) {
+            return FLT_MAX;
+        }
+        const float inverse = 1.0f / determinant;
+        const ::Vector3 s{
+            ray.origin.x - triangle.origin.x,
+            ray.origin.y - triangle.origin.y,
+            ray.origin.z - triangle.origin.z};
+        const float u = Dot(s, p) * inverse;
+        if (u < 0.0f || u > 1.0f) {
+            return FLT_MAX;
+        }
+        const ::Vector3 q = Cross(s, e1);
+        const float v = Dot(d, q) * inverse;
+        if (v < 0.0f || u + v > 1.0f) {
+            return FLT_MAX;
+        }
+        const float t = Dot(e2, q) * inverse;
+        return t > epsilon ? t : FLT_MAX;
+    }
+
+    /**
+     * Closest hit, or any hit when anyHit is set, nearer than distance, which receives its distance.
+     *
+     * @return The triangle hit in leaf order, or UINT32_MAX.
+     */
+    uint32_t Traverse(const RayData& ray, float& distance, bool anyHit) const {
+        if (triangles.empty() || Enter(nodes[0], ray, distance) == FLT_MAX) {
+            return UINT32_MAX;
+        }
+        uint32_t hit = UINT32_MAX;
+        uint32_t stack[maxDepth + 2];
+        int size = 0;
+        stack[size++] = 0;
+        while (size > 0) {
+            const Node& node = nodes[stack[--size]];
+            if (node.count > 0) {
+                for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                    const float t = Intersect(triangles[i], ray);
+                    if (t < distance) {
+                        distance = t;
+                        hit = i;
+                        if (anyHit) {
+                            return hit;
+                        }
+                    }
+                }
+                continue;
+            }
+
+            // Visit the nearer child first, so the closest hit found prunes the other
+            const float left = Enter(nodes[node.first], ray, distance);
+            const float right = Enter(nodes[node.first + 1], ray, distance);
+            if (left != FLT_MAX && right != FLT_MAX) {
+                stack[size++] = left <= right ? node.first + 1 : node.first;
+                stack[size++] = left <= right ? node.first : node.first + 1;
+            } else if (left != FLT_MAX) {
+                stack[size++] = node.first;
+            } else if (right != FLT_MAX) {
+                stack[size++] = node.first + 1;
+            }
+        }
+        return hit;
+    }
+
+#ifdef RAYLIB_CPP_SSE2
+    /**
+     * Trace up to four rays together, testing every node and triangle against all of them at once.
+     */
+    void TraversePacket(const ::Ray* rays, size_t count, float maxDistance, ::RayCollision* collisions) const {
+        alignas(16) float values[9][4];
+        for (size_t lane = 0; lane < 4; lane++) {
+            // Unused lanes repeat the first ray, their results are dropped
+            const ::Ray& ray = rays[lane < count ? lane : 0];
+            const float data[9] = {
+                ray.position.x,
+                ray.position.y,
+                ray.position.z,
+                ray.direction.x,
+                ray.direction.y,
+                ray.direction.z,
+                1.0f / ray.direction.x,
+                1.0f / ray.direction.y,
+                1.0f / ray.direction.z};
+            for (size_t i = 0; i < 9; i++) {
+                values[i][lane] = data[i];
+            }
+        }
+        const __m128 ox = _mm_load_ps(values[0]);
+        const __m128 oy = _mm_load_ps(values[1]);
+        const __m128 oz = _mm_load_ps(values[2]);
+        const __m128 dx = _mm_load_ps(values[3]);
+        const __m128 dy = _mm_load_ps(values[4]);
+        const __m128 dz = _mm_load_ps(values[5]);
+        const __m128 ix = _mm_load_ps(values[6]);
+        const __m128 iy = _mm_load_ps(values[7]);
+        const __m128 iz = _mm_load_ps(values[8]);
+        __m128 distance = _mm_set1_ps(maxDistance);
+        uint32_t hits[4] = {UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX};
+
+        // Entry distances of the four rays, with the mask of those that hit the node
+        const auto enter = [&](const Node& node, __m128& near) {
+            near = _mm_setzero_ps();
+            __m128 far = distance;
+            const auto slab = [&near, &far](float min, float max, __m128 origin, __m128 inverse) {
+                const __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(min), origin), inverse);
+                const __m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(max), origin), inverse);
+                // Lanes running along a face of the node give 0 * inf = NaN, set to all ones (a NaN) here so the
+                // min and max, which return their second operand for a NaN, skip the slab like Enter() does
+                const __m128 parallel = _mm_cmpunord_ps(t1, t2);
+                near = _mm_max_ps(_mm_or_ps(_mm_min_ps(t1, t2), parallel), near);
+                far = _mm_min_ps(_mm_or_ps(_mm_max_ps(t1, t2), parallel), far);
+            };
+            slab(node.min.x, node.max.x, ox, ix);
+            slab(node.min.y, node.max.y, oy, iy);
+            slab(node.min.z, node.max.z, oz, iz);
+            return _mm_movemask_ps(_mm_cmple_ps(near, far));
+        };
+        const auto nearest = [](__m128 near, int mask) {
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, near);
+            float result = FLT_MAX;
+            for (int lane = 0; lane < 4; lane++) {
+                result = (mask & (1 << lane)) != 0 ? std::min(result, lanes[lane]) : result;
+            }
+            return result;
+        };
+
+        uint32_t stack[maxDepth + 2];
+        int size = 0;
+        __m128 near;
+        if (!triangles.empty() && enter(nodes[0], near) != 0) {
+            stack[size++] = 0;
+        }
+        const __m128 epsilons = _mm_set1_ps(epsilon);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        while (size > 0) {
+            const Node& node = nodes[stack[--size]];
+            if (node.count == 0) {
+                __m128 leftNear;
+                __m128 rightNear;
+                const int left = enter(nodes[node.first], leftNear);
+                const int right = enter(nodes[node.first + 1], rightNear);
+                const bool leftFirst = nearest(leftNear, left) <= nearest(rightNear, right);
+                if (right != 0 && (left == 0 || leftFirst)) {
+                    stack[size++] = node.first + 1;
+                }
+                if (left != 0) {
+                    stack[size++] = node.first;
+                }
+                if (right != 0 && left != 0 && !leftFirst) {
+                    stack[size++] = node.first + 1;
+                }
+                continue;
+            }
+
+            for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                const Triangle& triangle = triangles[i];
+                const __m128 e1x = _mm_set1_ps(triangle.edge1.x);
+                const __m128 e1y = _mm_set1_ps(triangle.edge1.y);
+                const __m128 e1z = _mm_set1_ps(triangle.edge1.z);
+                const __m128 e2x = _mm_set1_ps(triangle.edge2.x);
+                const __m128 e2y = _mm_set1_ps(triangle.edge2.y);
+                const __m128 e2z = _mm_set1_ps(triangle.edge2.z);
+                const __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+                const __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+                const __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+                const __m128 determinant =
+                    _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+                const __m128 absDeterminant = _mm_max_ps(determinant, _mm_sub_ps(zero, determinant));
+                __m128 valid = _mm_cmpge_ps(absDeterminant, epsilons);
+                const __m128 inverse = _mm_div_ps(one, determinant);
+                const __m128 sx = _mm_sub_ps(ox, _mm_set1_ps(triangle.origin.x));
+                const __m128 sy = _mm_sub_ps(oy, _mm_set1_ps(triangle.origin.y));
+                const __m128 sz = _mm_sub_ps(oz, _mm_set1_ps(triangle.origin.z));
+                const __m128 u = _mm_mul_ps(
+                    _mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)),
+                    inverse);
+                const __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+                const __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+                const __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+                const __m128 v = _mm_mul_ps(
+                    _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)),
+                    inverse);
+                const __m128 t = _mm_mul_ps(
+                    _mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)),
+                    inverse);
+                valid = _mm_and_ps(valid, _mm_cmpge_ps(u, zero));
+                valid = _mm_and_ps(valid, _mm_cmpge_ps(v, zero));
+                valid = _mm_and_ps(valid, _mm_cmple_ps(_mm_add_ps(u, v), one));
+                valid = _mm_and_ps(valid, _mm_cmpgt_ps(t, epsilons));
+                valid = _mm_and_ps(valid, _mm_cmplt_ps(t, distance));
+                const int mask = _mm_movemask_ps(valid);
+                if (mask == 0) {
+                    continue;
+                }
+                distance = _mm_or_ps(_mm_and_ps(valid, t), _mm_andnot_ps(valid, distance));
+                for (int lane = 0; lane < 4; lane++) {
+                    hits[lane] = (mask & (1 << lane)) != 0 ? i : hits[lane];
+                }
+            }
+        }
+
+        alignas(16) float distances[4];
+        _mm_store_ps(distances, distance);
+        for (size_t lane = 0; lane < count; lane++) {
+            collisions[lane] = hits[lane] == UINT32_MAX ? ::RayCollision{}
+                                                         : MakeCollision(rays[lane], distances[lane], hits[lane]);
+        }
+    }
+#endif
+
+    template<typename NodeTest, typename TriangleTest>
+    size_t Overlap(NodeTest nodeTest, TriangleTest triangleTest, std::vector<int>& result) const {
+        if (triangles.empty() || !nodeTest(nodes[0])) {
+            return 0;
+        }
+        const size_t before = result.size();
+        uint32_t stack[maxDepth + 2];
+        int size = 0;
+        stack[size++] = 0;
+        while (size > 0) {
+            const Node& node = nodes[stack[--size]];
+            if (node.count > 0) {
+                for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                    if (triangleTest(triangles[i])) {
+                        result.push_back(triangleIds[i]);
+                    }
+                }
+                continue;
+            }
+            for (uint32_t child = node.first; child < node.first + 2; child++) {
+                if (nodeTest(nodes[child])) {
+                    stack[size++] = child;
+                }
+            }
+        }
+        return result.size() - before;
+    }
+
+    ::RayCollision MakeCollision(const ::Ray& ray, float distance, uint32_t triangle) const {
+        const Triangle& t = triangles[triangle];
+        ::RayCollision collision{};
+        collision.hit = true;
+        collision.distance = distance;
+        collision.point = {
+            ray.position.x + ray.direction.x * distance,
+            ray.position.y + ray.direction.y * distance,
+            ray.position.z + ray.direction.z * distance};
+        collision.normal = Normalize(Cross(t.edge1, t.edge2));
+        return collision;
+    }
+
+    static ::Vector3 Cross(::Vector3 a, ::Vector3 b) {
+        return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+    }
+
+    static float Dot(::Vector3 a, ::Vector3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+    static ::Vector3 Normalize(::Vector3 v) {
+        const float length = std::sqrt(Dot(v, v));
+        return length > 0.0f ? ::Vector3{v.x / length, v.y / length, v.z / length} : v;
+    }
+
+    static ::Vector3 TransformPoint(const ::Matrix& m, ::Vector3 v) {
+        return {
+            m.m0 * v.x + m.m4 * v.y + m.m8 * v.z + m.m12,
+            m.m1 * v.x + m.m5 * v.y + m.m9 * v.z + m.m13,
+            m.m2 * v.x + m.m6 * v.y + m.m10 * v.z + m.m14};
+    }
+
+    static ::Vector3 TransformDirection(const ::Matrix& m, ::Vector3 v) {
+        return {
+            m.m0 * v.x + m.m4 * v.y + m.m8 * v.z,
+            m.m1 * v.x + m.m5 * v.y + m.m9 * v.z,
+            m.m2 * v.x + m.m6 * v.y + m.m10 * v.z};
+    }
+
+    /**
+     * Inverse of an affine transform
+     */
+    static ::Matrix Invert(const ::Matrix& m) {
+        const ::Vector3 x{m.m0, m.m1, m.m2};
+        const ::Vector3 y{m.m4, m.m5, m.m6};
+        const ::Vector3 z{m.m8, m.m9, m.m10};
+        const ::Vector3 yz = Cross(y, z);
+        const ::Vector3 zx = Cross(z, x);
+        const ::Vector3 xy = Cross(x, y);
+        const float determinant = Dot(x, yz);
+        const float inverse = determinant != 0.0f ? 1.0f / determinant : 0.0f;
+
+        // Rows of the inverse are the cross products of the columns
+        ::Matrix result{};
+        result.m0 = yz.x * inverse;
+        result.m4 = yz.y * inverse;
+        result.m8 = yz.z * inverse;
+        result.m1 = zx.x * inverse;
+        result.m5 = zx.y * inverse;
+        result.m9 = zx.z * inverse;
+        result.m2 = xy.x * inverse;
+        result.m6 = xy.y * inverse;
+        result.m10 = xy.z * inverse;
+        const ::Vector3 t = TransformDirection(result, {m.m12, m.m13, m.m14});
+        result.m12 = -t.x;
+        result.m13 = -t.y;
+        result.m14 = -t.z;
+        result.m15 = 1.0f;
+        return result;
+    }
+
+    /**
+     * Separating axis test of a triangle against a box, after Akenine-Möller.
+     */
+    static bool TriangleOverlapsBox(const Triangle& triangle, ::Vector3 center, ::Vector3 halfSize) {
+        const ::Vector3 v0{
+            triangle.origin.x - center.x,
+            triangle.origin.y - center.y,
+            triangle.origin.z - center.z};
+        const ::Vector3 v1{v0.x + triangle.edge1.x, v0.y + triangle.edge1.y, v0.z + triangle.edge1.z};
+        const ::Vector3 v2{v0.x + triangle.edge2.x, v0.y + triangle.edge2.y, v0.z + triangle.edge2.z};
+        const ::Vector3 edges[3] = {
+            triangle.edge1,
+            {v2.x - v1.x, v2.y - v1.y, v2.z - v1.z},
+            {-triangle.edge2.x, -triangle.edge2.y, -triangle.edge2.z}};
+        const auto separated = [&](::Vector3 axis) {
+            const float p0 = Dot(v0, axis);
+            const float p1 = Dot(v1, axis);
+            const float p2 = Dot(v2, axis);
+            const float radius = halfSize.x * std::fabs(axis.x) + halfSize.y * std::fabs(axis.y) +
+                                 halfSize.z * std::fabs(axis.z);
+            return std::min({p0, p1, p2}) > radius || std::max({p0, p1, p2}) < -radius;
+        };
+
+        // Box faces, then the triangle's plane, then the nine edge cross products
+        if (separated({1, 0, 0}) || separated({0, 1, 0}) || separated({0, 0, 1}) ||
+            separated(Cross(triangle.edge1, triangle.edge2))) {
+            return false;
+        }
+        for (const ::Vector3& edge : edges) {
+            if (separated({0, -edge.z, edge.y}) || separated({edge.z, 0, -edge.x}) ||
+                separated({-edge.y, edge.x, 0})) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Point of the triangle closest to p, after Ericson's Real-Time Collision Detection.
+     */
+    static ::Vector3 ClosestPoint(const Triangle& triangle, ::Vector3 p) {
+        const ::Vector3 a = triangle.origin;
+        const ::Vector3 ab = triangle.edge1;
+        const ::Vector3 ac = triangle.edge2;
+        const auto at = [&a](::Vector3 u, float s, ::Vector3 v, float t) {
+            return ::Vector3{a.x + u.x * s + v.x * t, a.y + u.y * s + v.y * t, a.z + u.z * s + v.z * t};
+        };
+
+        const ::Vector3 ap{p.x - a.x, p.y - a.y, p.z - a.z};
+        const float d1 = Dot(ab, ap);
+        const float d2 = Dot(ac, ap);
+        if (d1 <= 0.0f && d2 <= 0.0f) {
+            return a;
+        }
+        const ::Vector3 bp{ap.x - ab.x, ap.y - ab.y, ap.z - ab.z};
+        const float d3 = Dot(ab, bp);
+        const float d4 = Dot(ac, bp);
+        if (d3 >= 0.0f && d4 <= d3) {
+            return at(ab, 1.0f, ac, 0.0f);
+        }
+        const float vc = d1 * d4 - d3 * d2;
+        if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+            return at(ab, d1 / (d1 - d3), ac, 0.0f);
+        }
+        const ::Vector3 cp{ap.x - ac.x, ap.y - ac.y, ap.z - ac.z};
+        const float d5 = Dot(ab, cp);
+        const float d6 = Dot(ac, cp);
+        if (d6 >= 0.0f && d5 <= d6) {
+            return at(ab, 0.0f, ac, 1.0f);
+        }
+        const float vb = d5 * d2 - d1 * d6;
+        if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+            return at(ab, 0.0f, ac, d2 / (d2 - d6));
+        }
+        const float va = d3 * d6 - d5 * d4;
+        if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+            const float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            return at(ab, 1.0f - w, ac, w);
+        }
+        const float denominator = 1.0f / (va + vb + vc);
+        return at(ab, vb * denominator, ac, vc * denominator);
+    }
+
+    ThreadPool* pool{nullptr};
+    std::vector<Node> nodes{};
+    std::vector<Triangle> triangles{};
+    /** Index in the mesh of each triangle, in leaf order */
+    std::vector<int> triangleIds{};
+    int depth{0};
+};
+} // namespace raylib
+
+using RMeshBVH = raylib::MeshBVH;
+
+#endif // RAYLIB_CPP_INCLUDE_MESHBVH_HPP_
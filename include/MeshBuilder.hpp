@@ -0,0 +1,230 @@
+#ifndef RAYLIB_CPP_INCLUDE_MESHBUILDER_HPP_
+#define RAYLIB_CPP_INCLUDE_MESHBUILDER_HPP_
+
+#include <cstring>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "./Color.hpp"
+#include "./RaylibException.hpp"
+#include "./Vector2.hpp"
+#include "./Vector3.hpp"
+#include "./Vector4.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+
+static_assert(sizeof(raylib::Vector2) == 2 * sizeof(float) && std::is_standard_layout_v<raylib::Vector2>);
+static_assert(sizeof(raylib::Vector3) == 3 * sizeof(float) && std::is_standard_layout_v<raylib::Vector3>);
+static_assert(sizeof(raylib::Vector4) == 4 * sizeof(float) && std::is_standard_layout_v<raylib::Vector4>);
+static_assert(sizeof(raylib::Color) == 4 && std::is_standard_layout_v<raylib::Color>);
+
+/**
+ * Builds mesh vertex data in place.
+ *
+ * Each attribute buffer is allocated once, at its final size, the first time it is requested, and is handed to
+ * the built mesh without copying.
+ *
+ * @code
+ * raylib::MeshBuilder builder(4, 2);
+ * std::span<raylib::Vector3> positions = builder.Positions();
+ * ...
+ * raylib::Mesh mesh(builder.Build());
+ * mesh.Upload();
+ * @endcode
+ */
+class MeshBuilder {
+public:
+    /**
+     * @param vertexCount Number of vertices of the mesh.
+     * @param triangleCount Number of triangles, either indexed or, without indices, three vertices each.
+     */
+    MeshBuilder(int vertexCount, int triangleCount) : mesh{} {
+        if (vertexCount < 0 || triangleCount < 0) {
+            throw RaylibException("MeshBuilder requires non-negative vertex and triangle counts");
+        }
+        mesh.vertexCount = vertexCount;
+        mesh.triangleCount = triangleCount;
+    }
+
+    MeshBuilder(const MeshBuilder&) = delete;
+    MeshBuilder& operator=(const MeshBuilder&) = delete;
+
+    MeshBuilder(MeshBuilder&& other) noexcept : mesh(other.mesh), indices32(std::move(other.indices32)) {
+        other.mesh = {};
+    }
+
+    MeshBuilder& operator=(MeshBuilder&& other) noexcept {
+        if (this != &other) {
+            Unload();
+            mesh = other.mesh;
+            indices32 = std::move(other.indices32);
+            other.mesh = {};
+        }
+        return *this;
+    }
+
+    ~MeshBuilder() { Unload(); }
+
+    [[nodiscard]] int GetVertexCount() const { return mesh.vertexCount; }
+    [[nodiscard]] int GetTriangleCount() const { return mesh.triangleCount; }
+
+    /**
+     * Vertex positions (shader-location = 0)
+     */
+    std::span<raylib::Vector3> Positions() { return Attribute<raylib::Vector3>(mesh.vertices, mesh.vertexCount); }
+
+    /**
+     * Vertex texture coordinates (shader-location = 1)
+     */
+    std::span<raylib::Vector2> TexCoords() { return Attribute<raylib::Vector2>(mesh.texcoords, mesh.vertexCount); }
+
+    /**
+     * Vertex normals (shader-location = 2)
+     */
+    std::span<raylib::Vector3> Normals() { return Attribute<raylib::Vector3>(mesh.normals, mesh.vertexCount); }
+
+    /**
+     * Vertex colors (shader-location = 3)
+     */
+    std::span<raylib::Color> Colors() { return Attribute<raylib::Color>(mesh.colors, mesh.vertexCount); }
+
+    /**
+     * Vertex tangents, xyz and the bitangent sign in w (shader-location = 4)
+     */
+    std::span<raylib::Vector4> Tangents() { return Attribute<raylib::Vector4>(mesh.tangents, mesh.vertexCount); }
+
+    /**
+     * Vertex second texture coordinates (shader-location = 5)
+     */
+    std::span<raylib::Vector2> TexCoords2() {
+        return Attribute<raylib::Vector2>(mesh.texcoords2, mesh.vertexCount);
+    }
+
+    /**
+     * 16-bit triangle indices, written straight into the mesh.
+     */
+    std::span<unsigned short> Indices() { // NOLINT
+        if (!indices32.empty()) {
+            throw RaylibException("MeshBuilder indices were already requested as 32-bit");
+        }
+        return Attribute<unsigned short>(mesh.indices, mesh.triangleCount * 3); // NOLINT
+    }
+
+    /**
+     * 32-bit triangle indices, for meshes with more than 65536 vertices.
+     *
+     * raylib meshes only store 16-bit indices: on Build() these are narrowed when every index fits, otherwise
+     * the mesh is de-indexed into three vertices per triangle.
+     */
+    std::span<unsigned int> Indices32() {
+        if (mesh.indices != nullptr) {
+            throw RaylibException("MeshBuilder indices were already requested as 16-bit");
+        }
+        indices32.resize(static_cast<size_t>(mesh.triangleCount) * 3);
+        return indices32;
+    }
+
+    /**
+     * Hands the vertex data over to a mesh, without uploading it to the GPU, and resets the builder.
+     *
+     * @throws raylib::RaylibException Throws if a 32-bit index is past the last vertex, leaving the builder as is.
+     *
+     * @see raylib::MeshUnmanaged::Upload()
+     */
+    [[nodiscard]] ::Mesh Build() {
+        if (!indices32.empty()) {
+            ResolveIndices32();
+        }
+
+        ::Mesh result = mesh;
+        mesh = {};
+        return result;
+    }
+
+    /**
+     * Frees the vertex data that was not handed over to a mesh.
+     */
+    void Unload() {
+        RL_FREE(mesh.vertices);
+        RL_FREE(mesh.texcoords);
+        RL_FREE(mesh.texcoords2);
+        RL_FREE(mesh.normals);
+        RL_FREE(mesh.tangents);
+        RL_FREE(mesh.colors);
+        RL_FREE(mesh.indices);
+        mesh = {};
+        indices32.clear();
+    }
+protected:
+    template<typename T, typename Storage>
+    static std::span<T> Attribute(Storage*& buffer, int count) {
+        static_assert(sizeof(T) % sizeof(Storage) == 0);
+        if (buffer == nullptr && count > 0) {
+            buffer = static_cast<Storage*>(RL_CALLOC(static_cast<size_t>(count), sizeof(T)));
+        }
+        return {reinterpret_cast<T*>(buffer), buffer != nullptr ? static_cast<size_t>(count) : 0};
+    }
+
+    /**
+     * Narrows the 32-bit indices, or de-indexes the mesh when they do not fit in 16 bits.
+     */
+    void ResolveIndices32() {
+        const auto vertexCount = static_cast<unsigned int>(mesh.vertexCount);
+        for (const unsigned int index : indices32) {
+            if (index >= vertexCount) {
+                throw RaylibException("MeshBuilder index " + std::to_string(index) + " is past the last vertex");
+            }
+        }
+
+        if (vertexCount <= 65536) {
+            std::span<unsigned short> narrow = // NOLINT
+                Attribute<unsigned short>(mesh.indices, mesh.triangleCount * 3); // NOLINT
+            for (size_t i = 0; i < indices32.size(); i++) {
+                narrow[i] = static_cast<unsigned short>(indices32[i]); // NOLINT
+            }
+            indices32.clear();
+            return;
+        }
+
+        const int expandedCount = mesh.triangleCount * 3;
+        Expand(mesh.vertices, 3, expandedCount);
+        Expand(mesh.texcoords, 2, expandedCount);
+        Expand(mesh.texcoords2, 2, expandedCount);
+        Expand(mesh.normals, 3, expandedCount);
+        Expand(mesh.tangents, 4, expandedCount);
+        Expand(mesh.colors, 4, expandedCount);
+        mesh.vertexCount = expandedCount;
+        indices32.clear();
+    }
+
+    /**
+     * Copies the vertex of each index, which ResolveIndices32() checked to be in range.
+     */
+    template<typename Storage>
+    void Expand(Storage*& buffer, size_t components, int vertexCount) {
+        if (buffer == nullptr) {
+            return;
+        }
+
+        const size_t size = static_cast<size_t>(vertexCount) * components * sizeof(Storage);
+        auto* expanded = static_cast<Storage*>(RL_MALLOC(size));
+        for (size_t i = 0; i < indices32.size(); i++) {
+            memcpy(expanded + i * components, buffer + indices32[i] * components, components * sizeof(Storage));
+        }
+        RL_FREE(buffer);
+        buffer = expanded;
+    }
+
+    ::Mesh mesh;
+    std::vector<unsigned int> indices32{};
+};
+} // namespace raylib
+
+using RMeshBuilder = raylib::MeshBuilder;
+
+#endif // RAYLIB_CPP_INCLUDE_MESHBUILDER_HPP_
@@ -0,0 +1,357 @@
+#ifndef RAYLIB_CPP_INCLUDE_MESHCLUSTERS_HPP_
+#define RAYLIB_CPP_INCLUDE_MESHCLUSTERS_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include "./Frustum.hpp"
+#include "./MeshOptimizer.hpp"
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Splits a mesh into small clusters of nearby triangles (meshlets) with their bounds, to cull big static meshes
+ * per cluster on the CPU.
+ *
+ * Building the clusters reorders the triangles of the mesh so each cluster is one contiguous index range: build
+ * them before MeshUnmanaged::Upload(), or upload the mesh again afterwards.
+ *
+ * @code
+ * raylib::MeshClusters clusters(mesh);
+ * ...
+ * std::vector<raylib::MeshClusters::IndexRange> ranges;
+ * clusters.Cull(raylib::Frustum(MatrixMultiply(view, projection)), camera.position, ranges);
+ * @endcode
+ */
+class MeshClusters {
+public:
+    /**
+     * Triangles of a cluster and their bounds, in mesh space.
+     */
+    struct Cluster {
+        /** First index of the cluster, or first vertex for non-indexed meshes */
+        unsigned int indexOffset{0};
+        unsigned int indexCount{0};
+        unsigned int vertexCount{0};
+
+        /** Bounding sphere */
+        ::Vector3 center{0.0f, 0.0f, 0.0f};
+        float radius{0.0f};
+
+        ::BoundingBox box{};
+
+        /**
+         * Normal cone: the cluster faces away from viewers for which
+         * dot(normalize(coneApex - viewer), coneAxis) >= coneCutoff. The cutoff is above 1 when the triangles face
+         * too many directions to ever be back facing together.
+         */
+        ::Vector3 coneApex{0.0f, 0.0f, 0.0f};
+        ::Vector3 coneAxis{0.0f, 0.0f, 0.0f};
+        float coneCutoff{2.0f};
+    };
+
+    /**
+     * Contiguous indices to draw, or vertices for non-indexed meshes.
+     */
+    struct IndexRange {
+        unsigned int offset{0};
+        unsigned int count{0};
+    };
+
+    MeshClusters() = default;
+
+    /**
+     * Build the clusters of a mesh, see Build()
+     */
+    explicit MeshClusters(::Mesh& mesh, unsigned int maxVertices = 64, unsigned int maxTriangles = 124) {
+        Build(mesh, maxVertices, maxTriangles);
+    }
+
+    /**
+     * Group the triangles into clusters of at most maxVertices vertices and maxTriangles triangles, and reorder
+     * the mesh to make each cluster contiguous.
+     *
+     * Clusters grow greedily over shared vertices, preferring triangles that add the fewest vertices and are
+     * closest to the cluster. Vertices of non-indexed meshes are matched by their attributes.
+     */
+    void Build(::Mesh& mesh, unsigned int maxVertices = 64, unsigned int maxTriangles = 124) {
+        if (maxVertices < 3 || maxTriangles < 1) {
+            throw RaylibException("MeshClusters requires at least 3 vertices and 1 triangle per cluster");
+        }
+        clusters.clear();
+        if (mesh.vertices == nullptr || mesh.triangleCount == 0) {
+            return;
+        }
+
+        // Vertex ids: the indices, or the identical vertices of non-indexed meshes
+        const auto triangleCount = static_cast<size_t>(mesh.triangleCount);
+        std::vector<unsigned int> ids(triangleCount * 3);
+        if (mesh.indices != nullptr) {
+            std::copy(mesh.indices, mesh.indices + ids.size(), ids.begin());
+        } else {
+            std::vector<unsigned int> unique;
+            const std::vector<unsigned int> remap = MeshOptimizer::GenerateRemap(mesh, unique);
+            std::copy(remap.begin(), remap.begin() + static_cast<std::ptrdiff_t>(ids.size()), ids.begin());
+        }
+        const size_t idCount = static_cast<size_t>(*std::max_element(ids.begin(), ids.end())) + 1;
+
+        std::vector<unsigned int> offsets;
+        std::vector<unsigned int> adjacency;
+        MeshOptimizer::BuildAdjacency(std::span<const unsigned int>(ids), idCount, offsets, adjacency);
+        std::vector<unsigned int> remaining(idCount);
+        for (size_t v = 0; v < idCount; v++) {
+            remaining[v] = offsets[v + 1] - offsets[v];
+        }
+
+        const auto position = [&mesh, &ids](size_t triangle, size_t corner) {
+            const size_t vertex = mesh.indices != nullptr ? ids[triangle * 3 + corner] : triangle * 3 + corner;
+            const float* p = mesh.vertices + vertex * 3;
+            return ::Vector3{p[0], p[1], p[2]};
+        };
+
+        std::vector<bool> emitted(triangleCount, false);
+        std::vector<unsigned int> clusterOf(idCount, MeshOptimizer::noVertex);
+        std::vector<unsigned int> clusterVertices;
+        std::vector<unsigned int> order;
+        order.reserve(triangleCount);
+        size_t cursor = 0;
+        unsigned int next = MeshOptimizer::noVertex;
+        ::Vector3 sum{0.0f, 0.0f, 0.0f};
+
+        while (order.size() < triangleCount) {
+            // Start a cluster next to the previous one when possible, otherwise at the first triangle left
+            if (next == MeshOptimizer::noVertex) {
+                while (emitted[cursor]) {
+                    cursor++;
+                }
+                next = static_cast<unsigned int>(cursor);
+            }
+            Cluster cluster;
+            cluster.indexOffset = static_cast<unsigned int>(order.size() * 3);
+            const auto clusterId = static_cast<unsigned int>(clusters.size());
+            clusterVertices.clear();
+            sum = {0.0f, 0.0f, 0.0f};
+
+            unsigned int triangle = next;
+            next = MeshOptimizer::noVertex;
+            while (triangle != MeshOptimizer::noVertex) {
+                emitted[triangle] = true;
+                order.push_back(triangle);
+                for (size_t k = 0; k < 3; k++) {
+                    const unsigned int v = ids[triangle * 3 + k];
+                    unsigned int* begin = adjacency.data() + offsets[v];
+                    unsigned int* end = begin + remaining[v];
+                    *std::find(begin, end, triangle) = *(end - 1);
+                    remaining[v]--;
+                    if (clusterOf[v] != clusterId) {
+                        clusterOf[v] = clusterId;
+                        clusterVertices.push_back(v);
+                        const ::Vector3 p = position(triangle, k);
+                        sum = {sum.x + p.x, sum.y + p.y, sum.z + p.z};
+                    }
+                }
+                if (order.size() * 3 - cluster.indexOffset >= maxTriangles * size_t{3}) {
+                    triangle = MeshOptimizer::noVertex;
+                    break;
+                }
+
+                // Best neighbouring triangle: fewest new vertices, then closest to the cluster centroid
+                const float scale = 1.0f / static_cast<float>(clusterVertices.size());
+                const ::Vector3 centroid{sum.x * scale, sum.y * scale, sum.z * scale};
+                float bestScore = 0.0f;
+                triangle = MeshOptimizer::noVertex;
+                for (unsigned int v : clusterVertices) {
+                    for (unsigned int i = offsets[v]; i < offsets[v] + remaining[v]; i++) {
+                        const unsigned int candidate = adjacency[i];
+                        unsigned int added = 0;
+                        for (size_t k = 0; k < 3; k++) {
+                            added += clusterOf[ids[candidate * size_t{3} + k]] != clusterId ? 1u : 0u;
+                        }
+                        if (clusterVertices.size() + added > maxVertices) {
+                            continue;
+                        }
+
+                        float distance = 0.0f;
+                        for (size_t k = 0; k < 3; k++) {
+                            const ::Vector3 p = position(candidate, k);
+                            const float x = p.x - centroid.x, y = p.y - centroid.y, z = p.z - centroid.z;
+                            distance += x * x + y * y + z * z;
+                        }
+                        const float score = static_cast<float>(added) * 1e30f + distance;
+                        if (triangle == MeshOptimizer::noVertex || score < bestScore) {
+                            bestScore = score;
+                            triangle = candidate;
+                        }
+                    }
+                }
+            }
+
+            // A triangle left next to the full cluster seeds the next one
+            for (size_t i = clusterVertices.size(); next == MeshOptimizer::noVertex && i > 0; i--) {
+                const unsigned int v = clusterVertices[i - 1];
+                if (remaining[v] > 0) {
+                    next = adjacency[offsets[v]];
+                }
+            }
+
+            cluster.indexCount = static_cast<unsigned int>(order.size() * 3) - cluster.indexOffset;
+            cluster.vertexCount = static_cast<unsigned int>(clusterVertices.size());
+            ComputeBounds(cluster, std::span<const unsigned int>(order).subspan(cluster.indexOffset / 3), position);
+            clusters.push_back(cluster);
+        }
+
+        // Make every cluster contiguous in the mesh
+        if (mesh.indices != nullptr) {
+            for (size_t t = 0; t < triangleCount; t++) {
+                for (size_t k = 0; k < 3; k++) {
+                    mesh.indices[t * 3 + k] = static_cast<unsigned short>(ids[order[t] * size_t{3} + k]); // NOLINT
+                }
+            }
+        } else {
+            std::vector<unsigned int> vertices(triangleCount * 3);
+            for (size_t t = 0; t < triangleCount; t++) {
+                for (size_t k = 0; k < 3; k++) {
+                    vertices[t * 3 + k] = static_cast<unsigned int>(order[t] * size_t{3} + k);
+                }
+            }
+            MeshOptimizer::RemapVertices(mesh, vertices);
+        }
+    }
+
+    [[nodiscard]] std::span<const Cluster> GetClusters() const { return clusters; }
+
+    [[nodiscard]] size_t GetClusterCount() const { return clusters.size(); }
+
+    /**
+     * Collect the index ranges of the clusters inside the frustum that face the camera, merging adjacent ones.
+     *
+     * The frustum and camera position must be in mesh space, see Frustum::Frustum(const ::Matrix&).
+     *
+     * @return The number of visible clusters.
+     */
+    size_t Cull(const Frustum& frustum, ::Vector3 cameraPosition, std::vector<IndexRange>& ranges) const {
+        ranges.clear();
+        size_t visible = 0;
+        for (const Cluster& cluster : clusters) {
+            if (!frustum.IsSphereVisible(cluster.center, cluster.radius) || IsBackFacing(cluster, cameraPosition)) {
+                continue;
+            }
+
+            visible++;
+            if (!ranges.empty() && ranges.back().offset + ranges.back().count == cluster.indexOffset) {
+                ranges.back().count += cluster.indexCount;
+            } else {
+                ranges.push_back({cluster.indexOffset, cluster.indexCount});
+            }
+        }
+        return visible;
+    }
+
+    /**
+     * Whether every triangle of the cluster faces away from the viewer
+     */
+    static bool IsBackFacing(const Cluster& cluster, ::Vector3 viewer) {
+        if (cluster.coneCutoff > 1.0f) {
+            return false;
+        }
+
+        const float x = cluster.coneApex.x - viewer.x;
+        const float y = cluster.coneApex.y - viewer.y;
+        const float z = cluster.coneApex.z - viewer.z;
+        const float dot = x * cluster.coneAxis.x + y * cluster.coneAxis.y + z * cluster.coneAxis.z;
+        return dot >= cluster.coneCutoff * std::sqrt(x * x + y * y + z * z);
+    }
+protected:
+    /**
+     * Box, sphere around the box center, and normal cone of the triangles.
+     */
+    template<typename Position>
+    static void ComputeBounds(Cluster& cluster, std::span<const unsigned int> triangles, const Position& position) {
+        const size_t triangleCount = cluster.indexCount / 3;
+        cluster.box.min = cluster.box.max = position(triangles[0], 0);
+        ::Vector3 axis{0.0f, 0.0f, 0.0f};
+        for (size_t t = 0; t < triangleCount; t++) {
+            const ::Vector3 a = position(triangles[t], 0);
+            const ::Vector3 b = position(triangles[t], 1);
+            const ::Vector3 c = position(triangles[t], 2);
+            for (const ::Vector3& p : {a, b, c}) {
+                cluster.box.min = {std::min(cluster.box.min.x, p.x), std::min(cluster.box.min.y, p.y),
+                                   std::min(cluster.box.min.z, p.z)};
+                cluster.box.max = {std::max(cluster.box.max.x, p.x), std::max(cluster.box.max.y, p.y),
+                                   std::max(cluster.box.max.z, p.z)};
+            }
+            const ::Vector3 normal = Normal(a, b, c);
+            axis = {axis.x + normal.x, axis.y + normal.y, axis.z + normal.z};
+        }
+
+        cluster.center = {
+            (cluster.box.min.x + cluster.box.max.x) * 0.5f,
+            (cluster.box.min.y + cluster.box.max.y) * 0.5f,
+            (cluster.box.min.z + cluster.box.max.z) * 0.5f};
+        float radiusSquared = 0.0f;
+        for (size_t t = 0; t < triangleCount; t++) {
+            for (size_t k = 0; k < 3; k++) {
+                const ::Vector3 p = position(triangles[t], k);
+                const float x = p.x - cluster.center.x, y = p.y - cluster.center.y, z = p.z - cluster.center.z;
+                radiusSquared = std::max(radiusSquared, x * x + y * y + z * z);
+            }
+        }
+        cluster.radius = std::sqrt(radiusSquared);
+
+        // The area weighted mean normal is the cone axis, the widest triangle normal sets the cutoff
+        const float length = std::sqrt(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
+        if (length == 0.0f) {
+            return;
+        }
+        axis = {axis.x / length, axis.y / length, axis.z / length};
+        float minDot = 1.0f;
+        float apexDistance = 0.0f;
+        for (size_t t = 0; t < triangleCount; t++) {
+            const ::Vector3 a = position(triangles[t], 0);
+            ::Vector3 normal = Normal(a, position(triangles[t], 1), position(triangles[t], 2));
+            const float area = std::sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+            if (area == 0.0f) {
+                continue;
+            }
+            normal = {normal.x / area, normal.y / area, normal.z / area};
+            const float dot = normal.x * axis.x + normal.y * axis.y + normal.z * axis.z;
+            minDot = std::min(minDot, dot);
+            if (dot > 0.0f) {
+                // The apex sits behind the plane of every triangle
+                const float x = cluster.center.x - a.x, y = cluster.center.y - a.y, z = cluster.center.z - a.z;
+                apexDistance = std::max(apexDistance, (x * normal.x + y * normal.y + z * normal.z) / dot);
+            }
+        }
+
+        // Triangles must stay clearly within 90 degrees of the axis for the cone to be of any use
+        if (minDot <= 0.1f) {
+            return;
+        }
+        cluster.coneAxis = axis;
+        cluster.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+        cluster.coneApex = {
+            cluster.center.x - axis.x * apexDistance,
+            cluster.center.y - axis.y * apexDistance,
+            cluster.center.z - axis.z * apexDistance};
+    }
+
+    /**
+     * Counter-clockwise normal scaled by twice the area
+     */
+    static ::Vector3 Normal(::Vector3 a, ::Vector3 b, ::Vector3 c) {
+        const ::Vector3 u{b.x - a.x, b.y - a.y, b.z - a.z};
+        const ::Vector3 v{c.x - a.x, c.y - a.y, c.z - a.z};
+        return {u.y * v.z - u.z * v.y, u.z * v.x - u.x * v.z, u.x * v.y - u.y * v.x};
+    }
+
+    std::vector<Cluster> clusters{};
+};
+} // namespace raylib
+
+using RMeshClusters = raylib::MeshClusters;
+
+#endif // RAYLIB_CPP_INCLUDE_MESHCLUSTERS_HPP_
@@ -0,0 +1,258 @@
+#ifndef RAYLIB_CPP_INCLUDE_MESHGENERATOR_HPP_
+#define RAYLIB_CPP_INCLUDE_MESHGENERATOR_HPP_
+
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include "./MeshBuilder.hpp"
+#include "./MeshUnmanaged.hpp"
+#include "./RaylibException.hpp"
+#include "./ThreadPool.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Procedural mesh generators that write straight into the final attribute buffers, splitting rows across
+ * ThreadPool::GetDefault().
+ *
+ * Pass upload = false to only build the mesh on the CPU, i.e. for tests, benchmarks or worker threads, and call
+ * MeshUnmanaged::Upload() later from the main thread.
+ */
+class MeshGenerator {
+public:
+    /**
+     * Generate a flat grid on the XZ plane, centered on the origin and facing up
+     *
+     * @param resX Number of cells along X.
+     * @param resZ Number of cells along Z.
+     * @param textureScale Number of times the texture coordinates repeat over the grid.
+     */
+    static MeshUnmanaged Grid(
+        float width,
+        float length,
+        int resX,
+        int resZ,
+        float textureScale = 1.0f,
+        bool upload = true) {
+        if (resX < 1 || resZ < 1) {
+            throw RaylibException("Grid mesh requires at least one cell per axis");
+        }
+
+        const int columns = resX + 1;
+        const int rows = resZ + 1;
+        MeshBuilder builder(columns * rows, resX * resZ * 2);
+        std::span<raylib::Vector3> positions = builder.Positions();
+        std::span<raylib::Vector3> normals = builder.Normals();
+        std::span<raylib::Vector2> texcoords = builder.TexCoords();
+
+        ForEachRow(rows, [&](int z) {
+            const float v = static_cast<float>(z) / static_cast<float>(resZ);
+            for (int x = 0; x < columns; x++) {
+                const float u = static_cast<float>(x) / static_cast<float>(resX);
+                const size_t i = Index(x, z, columns);
+                positions[i] = raylib::Vector3((u - 0.5f) * width, 0.0f, (v - 0.5f) * length);
+                normals[i] = raylib::Vector3(0.0f, 1.0f, 0.0f);
+                texcoords[i] = raylib::Vector2(u * textureScale, v * textureScale);
+            }
+        });
+        GridIndices(builder, columns, rows);
+
+        return Finish(builder, upload);
+    }
+
+    /**
+     * Generate an indexed heightmap mesh with smooth normals from image data
+     *
+     * Each pixel becomes one vertex, its height is the average of the RGB channels scaled to size.y.
+     */
+    static MeshUnmanaged Heightmap(const ::Image& heightmap, ::Vector3 size, bool upload = true) {
+        if (heightmap.data == nullptr || heightmap.width < 2 || heightmap.height < 2) {
+            throw RaylibException("Heightmap mesh requires an image of at least 2x2 pixels");
+        }
+
+        const size_t count = static_cast<size_t>(heightmap.width) * static_cast<size_t>(heightmap.height);
+        std::vector<float> heights(count);
+        ::Color* pixels = ::LoadImageColors(heightmap);
+        for (size_t i = 0; i < count; i++) {
+            heights[i] = static_cast<float>(pixels[i].r + pixels[i].g + pixels[i].b) / (3.0f * 255.0f);
+        }
+        ::UnloadImageColors(pixels);
+
+        return Heightmap(heights, heightmap.width, heightmap.height, size, upload);
+    }
+
+    /**
+     * Generate an indexed heightmap mesh with smooth normals from normalized heights
+     *
+     * @param heights Row-major heights in [0.0f..1.0f], width * depth values.
+     * @param size Size of the mesh, which spans from the origin to size.
+     */
+    static MeshUnmanaged Heightmap(std::span<const float> heights, int width, int depth, ::Vector3 size,
+            bool upload = true) {
+        if (width < 2 || depth < 2 || heights.size() < static_cast<size_t>(width) * static_cast<size_t>(depth)) {
+            throw RaylibException("Heightmap mesh requires at least 2x2 heights");
+        }
+
+        const float stepX = size.x / static_cast<float>(width - 1);
+        const float stepZ = size.z / static_cast<float>(depth - 1);
+        MeshBuilder builder(width * depth, (width - 1) * (depth - 1) * 2);
+        std::span<raylib::Vector3> positions = builder.Positions();
+        std::span<raylib::Vector3> normals = builder.Normals();
+        std::span<raylib::Vector2> texcoords = builder.TexCoords();
+
+        ForEachRow(depth, [&](int z) {
+            const auto height = [&](int x, int row) { return heights[Index(x, row, width)] * size.y; };
+            const int up = z > 0 ? z - 1 : z;
+            const int down = z < depth - 1 ? z + 1 : z;
+            for (int x = 0; x < width; x++) {
+                const size_t i = Index(x, z, width);
+                positions[i] =
+                    raylib::Vector3(static_cast<float>(x) * stepX, height(x, z), static_cast<float>(z) * stepZ);
+                texcoords[i] = raylib::Vector2(
+                    static_cast<float>(x) / static_cast<float>(width - 1),
+                    static_cast<float>(z) / static_cast<float>(depth - 1));
+
+                // Central differences, one-sided on the borders
+                const int left = x > 0 ? x - 1 : x;
+                const int right = x < width - 1 ? x + 1 : x;
+                const float slopeX = (height(right, z) - height(left, z)) / (static_cast<float>(right - left) * stepX);
+                const float slopeZ = (height(x, down) - height(x, up)) / (static_cast<float>(down - up) * stepZ);
+                const float length = std::sqrt(slopeX * slopeX + 1.0f + slopeZ * slopeZ);
+                normals[i] = raylib::Vector3(-slopeX / length, 1.0f / length, -slopeZ / length);
+            }
+        });
+        GridIndices(builder, width, depth);
+
+        return Finish(builder, upload);
+    }
+
+    /**
+     * Generate an indexed UV sphere centered on the origin
+     *
+     * @param rings Number of subdivisions from pole to pole, at least 2.
+     * @param slices Number of subdivisions around the Y axis, at least 3.
+     */
+    static MeshUnmanaged Sphere(float radius, int rings, int slices, bool upload = true) {
+        if (rings < 2 || slices < 3) {
+            throw RaylibException("Sphere mesh requires at least 2 rings and 3 slices");
+        }
+
+        // Texture seams and poles need their own vertex per slice
+        const int columns = slices + 1;
+        MeshBuilder builder(columns * (rings + 1), slices * (rings - 1) * 2);
+        std::span<raylib::Vector3> positions = builder.Positions();
+        std::span<raylib::Vector3> normals = builder.Normals();
+        std::span<raylib::Vector2> texcoords = builder.TexCoords();
+
+        ForEachRow(rings + 1, [&](int ring) {
+            const float v = static_cast<float>(ring) / static_cast<float>(rings);
+            const float phi = PI * v;
+            for (int slice = 0; slice < columns; slice++) {
+                const float u = static_cast<float>(slice) / static_cast<float>(slices);
+                const float theta = 2.0f * PI * u;
+                const float x = std::sin(phi) * std::cos(theta);
+                const float y = std::cos(phi);
+                const float z = std::sin(phi) * std::sin(theta);
+                const size_t i = Index(slice, ring, columns);
+                positions[i] = raylib::Vector3(x * radius, y * radius, z * radius);
+                normals[i] = raylib::Vector3(x, y, z);
+                texcoords[i] = raylib::Vector2(u, v);
+            }
+        });
+
+        // The first and last rings only have one triangle per slice, the others two
+        const auto write = [&](auto indices) {
+            using Index = typename decltype(indices)::value_type;
+            ForEachRow(rings, [&](int ring) {
+                size_t t = ring == 0 ? 0 : static_cast<size_t>(slices) * 3 * static_cast<size_t>(2 * ring - 1);
+                for (int slice = 0; slice < slices; slice++) {
+                    const auto a = static_cast<Index>(ring * columns + slice);
+                    const auto b = static_cast<Index>(a + static_cast<Index>(columns));
+                    if (ring != 0) {
+                        indices[t++] = a;
+                        indices[t++] = static_cast<Index>(a + 1);
+                        indices[t++] = b;
+                    }
+                    if (ring != rings - 1) {
+                        indices[t++] = static_cast<Index>(a + 1);
+                        indices[t++] = static_cast<Index>(b + 1);
+                        indices[t++] = b;
+                    }
+                }
+            });
+        };
+
+        if (builder.GetVertexCount() > 65536) {
+            write(builder.Indices32());
+        } else {
+            write(builder.Indices());
+        }
+
+        return Finish(builder, upload);
+    }
+protected:
+    /** Rows handed to each thread pool task */
+    static constexpr size_t rowsPerTask = 16;
+
+    static size_t Index(int x, int z, int columns) {
+        return static_cast<size_t>(z) * static_cast<size_t>(columns) + static_cast<size_t>(x);
+    }
+
+    template<typename RowFunction>
+    static void ForEachRow(int rows, RowFunction&& row) {
+        const auto range = [&row](size_t first, size_t last) {
+            for (size_t z = first; z < last; z++) {
+                row(static_cast<int>(z));
+            }
+        };
+        ThreadPool::GetDefault().ParallelFor(static_cast<size_t>(rows > 0 ? rows : 0), rowsPerTask, range);
+    }
+
+    /**
+     * Two counter-clockwise triangles per grid cell, using 32-bit indices when the grid needs them.
+     */
+    static void GridIndices(MeshBuilder& builder, int columns, int rows) {
+        const auto write = [&](auto indices) {
+            using Index = typename decltype(indices)::value_type;
+            ForEachRow(rows - 1, [&](int z) {
+                size_t t = static_cast<size_t>(z) * static_cast<size_t>(columns - 1) * 6;
+                for (int x = 0; x < columns - 1; x++) {
+                    // Lower left corner of the cell
+                    const auto i = static_cast<Index>(z * columns + x);
+                    const auto right = static_cast<Index>(i + 1);
+                    const auto up = static_cast<Index>(i + static_cast<Index>(columns));
+                    const auto upRight = static_cast<Index>(up + 1);
+
+                    indices[t++] = up;
+                    indices[t++] = right;
+                    indices[t++] = i;
+
+                    indices[t++] = up;
+                    indices[t++] = upRight;
+                    indices[t++] = right;
+                }
+            });
+        };
+
+        if (builder.GetVertexCount() > 65536) {
+            write(builder.Indices32());
+        } else {
+            write(builder.Indices());
+        }
+    }
+
+    static MeshUnmanaged Finish(MeshBuilder& builder, bool upload) {
+        ::Mesh mesh = builder.Build();
+        if (upload) {
+            ::UploadMesh(&mesh, false);
+        }
+        return mesh;
+    }
+};
+} // namespace raylib
+
+using RMeshGenerator = raylib::MeshGenerator;
+
+#endif // RAYLIB_CPP_INCLUDE_MESHGENERATOR_HPP_
@@ -0,0 +1,840 @@
+#ifndef RAYLIB_CPP_INCLUDE_MESHOPTIMIZER_HPP_
+#define RAYLIB_CPP_INCLUDE_MESHOPTIMIZER_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Reorders mesh data on the CPU for faster rendering.
+ *
+ * All passes work on the vertex data in RAM: run them before MeshUnmanaged::Upload(), or upload the mesh again
+ * afterwards. Except for Weld(), they only apply to indexed meshes.
+ *
+ * @see raylib::MeshUnmanaged::Optimize()
+ */
+class MeshOptimizer {
+public:
+    /**
+     * Post-transform vertex cache efficiency of an index buffer, simulated with a FIFO cache.
+     */
+    struct VertexCacheStatistics {
+        /** Average cache miss ratio: transformed vertices per triangle, 0.5 at best and 3.0 at worst */
+        float acmr{0.0f};
+
+        /** Average transform to vertex ratio: transformed vertices per referenced vertex, 1.0 at best */
+        float atvr{0.0f};
+    };
+
+    /**
+     * Merges vertices that are identical in all attributes, turning non-indexed meshes into indexed ones.
+     *
+     * @throws raylib::RaylibException Throws if more than 65536 unique vertices remain, as indices are 16-bit.
+     */
+    static void Weld(::Mesh& mesh) {
+        if (mesh.vertices == nullptr || mesh.vertexCount == 0) {
+            return;
+        }
+
+        std::vector<unsigned int> unique;
+        const std::vector<unsigned int> remap = GenerateRemap(mesh, unique);
+        if (unique.size() > 65536) {
+            throw RaylibException("Welded mesh has more than 65536 vertices and can not use 16-bit indices");
+        }
+
+        std::vector<unsigned int> indices(static_cast<size_t>(mesh.triangleCount) * 3);
+        for (size_t i = 0; i < indices.size(); i++) {
+            indices[i] = remap[mesh.indices != nullptr ? mesh.indices[i] : i];
+        }
+        RemapVertices(mesh, unique);
+        SetIndices(mesh, indices);
+    }
+
+    /**
+     * Reorders triangles to reuse transformed vertices, using Tom Forsyth's linear-speed vertex cache optimization.
+     */
+    static void OptimizeVertexCache(::Mesh& mesh) {
+        if (mesh.indices == nullptr || mesh.triangleCount == 0) {
+            return;
+        }
+
+        const auto triangleCount = static_cast<size_t>(mesh.triangleCount);
+        const auto vertexCount = static_cast<size_t>(mesh.vertexCount);
+        const std::span<const unsigned short> indices(mesh.indices, triangleCount * 3); // NOLINT
+
+        std::vector<unsigned int> offsets;
+        std::vector<unsigned int> adjacency;
+        BuildAdjacency(indices, vertexCount, offsets, adjacency);
+
+        std::vector<unsigned int> remaining(vertexCount);
+        for (size_t v = 0; v < vertexCount; v++) {
+            remaining[v] = offsets[v + 1] - offsets[v];
+        }
+        std::vector<int> cachePosition(vertexCount, -1);
+        std::vector<float> vertexScore(vertexCount);
+        for (size_t v = 0; v < vertexCount; v++) {
+            vertexScore[v] = ForsythScore(-1, remaining[v]);
+        }
+        std::vector<float> triangleScore(triangleCount);
+        for (size_t t = 0; t < triangleCount; t++) {
+            triangleScore[t] =
+                vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+        }
+
+        std::vector<bool> emitted(triangleCount, false);
+        std::vector<unsigned int> cache;
+        std::vector<unsigned int> nextCache;
+        cache.reserve(forsythCacheSize + 3);
+        nextCache.reserve(forsythCacheSize + 3);
+        std::vector<unsigned int> output;
+        output.reserve(indices.size());
+
+        size_t cursor = 0;
+        auto best = static_cast<size_t>(-1);
+        while (output.size() < indices.size()) {
+            if (best == static_cast<size_t>(-1)) {
+                // Nothing in the cache is usable: continue with the next triangle that was not emitted yet
+                while (emitted[cursor]) {
+                    cursor++;
+                }
+                best = cursor;
+            }
+
+            emitted[best] = true;
+            nextCache.clear();
+            for (size_t k = 0; k < 3; k++) {
+                const unsigned int v = indices[best * 3 + k];
+                output.push_back(v);
+                nextCache.push_back(v);
+
+                // Take the triangle out of the vertex's remaining adjacency
+                unsigned int* begin = adjacency.data() + offsets[v];
+                unsigned int* end = begin + remaining[v];
+                *std::find(begin, end, static_cast<unsigned int>(best)) = *(end - 1);
+                remaining[v]--;
+            }
+            for (unsigned int v : cache) {
+                if (nextCache.size() >= forsythCacheSize + 3) {
+                    break;
+                }
+                if (std::find(nextCache.begin(), nextCache.begin() + 3, v) == nextCache.begin() + 3) {
+                    nextCache.push_back(v);
+                }
+            }
+
+            // Vertices pushed out of the cache lose their cache score
+            for (unsigned int v : cache) {
+                cachePosition[v] = -1;
+            }
+            for (size_t position = 0; position < nextCache.size(); position++) {
+                const unsigned int v = nextCache[position];
+                cachePosition[v] = position < forsythCacheSize ? static_cast<int>(position) : -1;
+            }
+            std::swap(cache, nextCache);
+
+            // Rescore the vertices that changed and pick the best triangle among their neighbours
+            for (unsigned int v : nextCache) {
+                if (cachePosition[v] < 0) {
+                    UpdateScores(v, -1, offsets, adjacency, remaining, vertexScore, triangleScore);
+                }
+            }
+            for (unsigned int v : cache) {
+                UpdateScores(v, cachePosition[v], offsets, adjacency, remaining, vertexScore, triangleScore);
+            }
+            float bestScore = -1.0f;
+            best = static_cast<size_t>(-1);
+            for (unsigned int v : cache) {
+                for (unsigned int i = 0; i < remaining[v]; i++) {
+                    const unsigned int t = adjacency[offsets[v] + i];
+                    if (triangleScore[t] > bestScore) {
+                        bestScore = triangleScore[t];
+                        best = t;
+                    }
+                }
+            }
+            if (cache.size() > forsythCacheSize) {
+                cache.resize(forsythCacheSize);
+            }
+        }
+
+        std::copy(output.begin(), output.end(), mesh.indices);
+    }
+
+    /**
+     * Reorders clusters of triangles so that outward facing ones are drawn first, which reduces overdraw.
+     *
+     * Run it after OptimizeVertexCache(): clusters start where the cache has to be refilled, so their order can
+     * change without hurting the vertex cache much.
+     *
+     * @param threshold Largest accepted increase of the ACMR, i.e. 1.05f keeps the new order only if it transforms
+     *                  at most 5% more vertices.
+     */
+    static void OptimizeOverdraw(::Mesh& mesh, float threshold = 1.05f) {
+        if (mesh.indices == nullptr || mesh.vertices == nullptr || mesh.triangleCount == 0) {
+            return;
+        }
+
+        const auto triangleCount = static_cast<size_t>(mesh.triangleCount);
+        const std::span<unsigned short> indices(mesh.indices, triangleCount * 3); // NOLINT
+        const VertexCacheStatistics before = AnalyzeVertexCache(mesh);
+
+        // Hard cluster boundaries: triangles whose three vertices all miss the simulated cache
+        std::vector<size_t> clusterStarts;
+        std::vector<unsigned int> timestamps(static_cast<size_t>(mesh.vertexCount), 0);
+        unsigned int time = fifoCacheSize + 1;
+        for (size_t t = 0; t < triangleCount; t++) {
+            int misses = 0;
+            for (size_t k = 0; k < 3; k++) {
+                const unsigned short v = indices[t * 3 + k]; // NOLINT
+                if (time - timestamps[v] > fifoCacheSize) {
+                    timestamps[v] = time++;
+                    misses++;
+                }
+            }
+            if (t == 0 || misses == 3) {
+                clusterStarts.push_back(t);
+            }
+        }
+        clusterStarts.push_back(triangleCount);
+        const size_t clusterCount = clusterStarts.size() - 1;
+        if (clusterCount < 2) {
+            return;
+        }
+
+        // Area weighted centroid and normal of the mesh and of each cluster
+        std::vector<float> sortKeys(clusterCount);
+        std::vector<::Vector3> centroids(clusterCount);
+        std::vector<::Vector3> normals(clusterCount);
+        ::Vector3 meshCentroid{0.0f, 0.0f, 0.0f};
+        float meshArea = 0.0f;
+        for (size_t c = 0; c < clusterCount; c++) {
+            ::Vector3 centroid{0.0f, 0.0f, 0.0f};
+            ::Vector3 normal{0.0f, 0.0f, 0.0f};
+            float area = 0.0f;
+            for (size_t t = clusterStarts[c]; t < clusterStarts[c + 1]; t++) {
+                const float* a = mesh.vertices + static_cast<size_t>(indices[t * 3]) * 3;
+                const float* b = mesh.vertices + static_cast<size_t>(indices[t * 3 + 1]) * 3;
+                const float* d = mesh.vertices + static_cast<size_t>(indices[t * 3 + 2]) * 3;
+                const ::Vector3 ab{b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+                const ::Vector3 ad{d[0] - a[0], d[1] - a[1], d[2] - a[2]};
+                const ::Vector3 cross{ab.y * ad.z - ab.z * ad.y, ab.z * ad.x - ab.x * ad.z, ab.x * ad.y - ab.y * ad.x};
+                const float triangleArea = std::sqrt(cross.x * cross.x + cross.y * cross.y + cross.z * cross.z);
+                centroid.x += (a[0] + b[0] + d[0]) / 3.0f * triangleArea;
+                centroid.y += (a[1] + b[1] + d[1]) / 3.0f * triangleArea;
+                centroid.z += (a[2] + b[2] + d[2]) / 3.0f * triangleArea;
+                normal.x += cross.x;
+                normal.y += cross.y;
+                normal.z += cross.z;
+                area += triangleArea;
+            }
+            meshCentroid = {meshCentroid.x + centroid.x, meshCentroid.y + centroid.y, meshCentroid.z + centroid.z};
+            meshArea += area;
+            const float scale = area > 0.0f ? 1.0f / area : 0.0f;
+            centroids[c] = {centroid.x * scale, centroid.y * scale, centroid.z * scale};
+            const float length = std::sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+            normals[c] = length > 0.0f ? ::Vector3{normal.x / length, normal.y / length, normal.z / length} : normal;
+        }
+        if (meshArea > 0.0f) {
+            meshCentroid = {meshCentroid.x / meshArea, meshCentroid.y / meshArea, meshCentroid.z / meshArea};
+        }
+        for (size_t c = 0; c < clusterCount; c++) {
+            sortKeys[c] = (centroids[c].x - meshCentroid.x) * normals[c].x +
+                          (centroids[c].y - meshCentroid.y) * normals[c].y +
+                          (centroids[c].z - meshCentroid.z) * normals[c].z;
+        }
+
+        std::vector<size_t> order(clusterCount);
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::stable_sort(order.begin(), order.end(), [&sortKeys](size_t a, size_t b) {
+            return sortKeys[a] > sortKeys[b];
+        });
+
+        const std::vector<unsigned short> original(indices.begin(), indices.end()); // NOLINT
+        size_t output = 0;
+        for (size_t c : order) {
+            const size_t first = clusterStarts[c] * 3;
+            const size_t last = clusterStarts[c + 1] * 3;
+            std::copy(original.begin() + static_cast<std::ptrdiff_t>(first),
+                original.begin() + static_cast<std::ptrdiff_t>(last),
+                indices.begin() + static_cast<std::ptrdiff_t>(output));
+            output += last - first;
+        }
+
+        if (AnalyzeVertexCache(mesh).acmr > before.acmr * threshold) {
+            std::copy(original.begin(), original.end(), indices.begin());
+        }
+    }
+
+    /**
+     * Reorders vertices in the order the index buffer first uses them, and drops unused vertices.
+     */
+    static void OptimizeVertexFetch(::Mesh& mesh) {
+        if (mesh.indices == nullptr || mesh.vertexCount == 0) {
+            return;
+        }
+
+        const auto indexCount = static_cast<size_t>(mesh.triangleCount) * 3;
+        std::vector<unsigned int> remap(static_cast<size_t>(mesh.vertexCount), noVertex);
+        std::vector<unsigned int> order;
+        order.reserve(static_cast<size_t>(mesh.vertexCount));
+        std::vector<unsigned int> indices(indexCount);
+        for (size_t i = 0; i < indexCount; i++) {
+            const unsigned short v = mesh.indices[i]; // NOLINT
+            if (remap[v] == noVertex) {
+                remap[v] = static_cast<unsigned int>(order.size());
+                order.push_back(v);
+            }
+            indices[i] = remap[v];
+        }
+
+        RemapVertices(mesh, order);
+        SetIndices(mesh, indices);
+    }
+
+    /**
+     * Runs all passes in order: Weld(), OptimizeVertexCache(), OptimizeOverdraw() and OptimizeVertexFetch().
+     */
+    static void Optimize(::Mesh& mesh, float overdrawThreshold = 1.05f) {
+        Weld(mesh);
+        OptimizeVertexCache(mesh);
+        OptimizeOverdraw(mesh, overdrawThreshold);
+        OptimizeVertexFetch(mesh);
+    }
+
+    /**
+     * Reduces the triangle count with quadric error metric edge collapses, i.e. to generate levels of detail.
+     *
+     * Each collapse moves a vertex onto a neighbour, so the remaining vertices keep their attributes. Vertices on
+     * borders and on UV, normal or other attribute seams are locked, so seams never tear. Non-indexed meshes are
+     * welded first. The result is indexed when at most 65536 vertices remain, otherwise it is de-indexed.
+     *
+     * @param targetRatio Fraction of the triangles to keep, in [0.0f..1.0f].
+     * @param maxError Largest allowed distance to the original surface, relative to the size of the mesh.
+     * @return The largest relative error of the collapses that were made.
+     */
+    static float Simplify(::Mesh& mesh, float targetRatio, float maxError = 0.01f) {
+        if (mesh.vertices == nullptr || mesh.triangleCount == 0) {
+            return 0.0f;
+        }
+
+        const auto vertexCount = static_cast<size_t>(mesh.vertexCount);
+        std::vector<unsigned int> indices(static_cast<size_t>(mesh.triangleCount) * 3);
+        if (mesh.indices != nullptr) {
+            std::copy(mesh.indices, mesh.indices + indices.size(), indices.begin());
+        } else {
+            std::vector<unsigned int> unique;
+            const std::vector<unsigned int> remap = GenerateRemap(mesh, unique);
+            for (size_t i = 0; i < indices.size(); i++) {
+                indices[i] = unique[remap[i]];
+            }
+        }
+        RemoveDegenerateTriangles(indices);
+
+        // Errors are measured on positions scaled to the unit cube
+        const std::vector<float> positions = LoadNormalizedPositions(mesh);
+        std::vector<Quadric> quadrics(vertexCount);
+        for (size_t t = 0; t < indices.size(); t += 3) {
+            const Quadric quadric = Quadric::FromTriangle(
+                &positions[indices[t] * 3], &positions[indices[t + 1] * 3], &positions[indices[t + 2] * 3]);
+            for (size_t k = 0; k < 3; k++) {
+                quadrics[indices[t + k]] += quadric;
+            }
+        }
+
+        const auto targetCount = static_cast<size_t>(
+            static_cast<float>(indices.size() / 3) * std::clamp(targetRatio, 0.0f, 1.0f));
+        const double maxCost = static_cast<double>(maxError) * static_cast<double>(maxError);
+        double resultCost = 0.0;
+        std::vector<unsigned int> offsets;
+        std::vector<unsigned int> adjacency;
+        std::vector<Collapse> collapses;
+        std::vector<bool> locked(vertexCount);
+        std::vector<bool> touched(vertexCount);
+        std::vector<unsigned int> remap(vertexCount);
+
+        // Each pass makes the cheapest collapses whose neighbourhoods do not overlap, then rebuilds the adjacency
+        while (indices.size() / 3 > targetCount) {
+            BuildAdjacency(std::span<const unsigned int>(indices), vertexCount, offsets, adjacency);
+            for (size_t v = 0; v < vertexCount; v++) {
+                locked[v] = !IsManifoldVertex(static_cast<unsigned int>(v), indices, offsets, adjacency);
+            }
+
+            collapses.clear();
+            for (size_t i = 0; i < indices.size(); i++) {
+                const unsigned int from = indices[i];
+                const unsigned int to = indices[i % 3 == 2 ? i - 2 : i + 1];
+                if (locked[from]) {
+                    continue;
+                }
+                Quadric quadric = quadrics[from];
+                quadric += quadrics[to];
+                const double cost = quadric.Error(&positions[to * 3]);
+                if (cost <= maxCost) {
+                    collapses.push_back({from, to, cost});
+                }
+            }
+            if (collapses.empty()) {
+                break;
+            }
+            std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+                return a.cost < b.cost;
+            });
+
+            std::iota(remap.begin(), remap.end(), 0u);
+            std::fill(touched.begin(), touched.end(), false);
+            const size_t removable = indices.size() / 3 - targetCount;
+            size_t removed = 0;
+            for (const Collapse& collapse : collapses) {
+                if (removed >= removable) {
+                    break;
+                }
+                if (touched[collapse.from] || FlipsTriangle(collapse, positions, indices, offsets, adjacency)) {
+                    continue;
+                }
+
+                // The neighbourhood of the moved vertex must stay as it is for the flip tests of this pass
+                for (unsigned int i = offsets[collapse.from]; i < offsets[collapse.from + 1]; i++) {
+                    const size_t t = adjacency[i] * size_t{3};
+                    for (size_t k = 0; k < 3; k++) {
+                        touched[indices[t + k]] = true;
+                    }
+                    if (indices[t] == collapse.to || indices[t + 1] == collapse.to || indices[t + 2] == collapse.to) {
+                        removed++;
+                    }
+                }
+                remap[collapse.from] = collapse.to;
+                quadrics[collapse.to] += quadrics[collapse.from];
+                resultCost = std::max(resultCost, collapse.cost);
+            }
+            if (removed == 0) {
+                break;
+            }
+
+            for (unsigned int& index : indices) {
+                index = remap[index];
+            }
+            RemoveDegenerateTriangles(indices);
+        }
+
+        StoreIndices(mesh, indices);
+        return static_cast<float>(std::sqrt(resultCost));
+    }
+
+    /**
+     * Simulates a FIFO post-transform vertex cache over the index buffer.
+     *
+     * For non-indexed meshes every vertex is a miss.
+     */
+    static VertexCacheStatistics AnalyzeVertexCache(const ::Mesh& mesh, unsigned int cacheSize = fifoCacheSize) {
+        VertexCacheStatistics statistics;
+        if (mesh.triangleCount == 0 || mesh.vertexCount == 0) {
+            return statistics;
+        }
+        if (mesh.indices == nullptr) {
+            statistics.acmr = 3.0f;
+            statistics.atvr = 1.0f;
+            return statistics;
+        }
+
+        const auto indexCount = static_cast<size_t>(mesh.triangleCount) * 3;
+        std::vector<unsigned int> timestamps(static_cast<size_t>(mesh.vertexCount), 0);
+        std::vector<bool> used(static_cast<size_t>(mesh.vertexCount), false);
+        unsigned int time = cacheSize + 1;
+        size_t misses = 0;
+        size_t usedCount = 0;
+        for (size_t i = 0; i < indexCount; i++) {
+            const unsigned short v = mesh.indices[i]; // NOLINT
+            if (time - timestamps[v] > cacheSize) {
+                timestamps[v] = time++;
+                misses++;
+            }
+            if (!used[v]) {
+                used[v] = true;
+                usedCount++;
+            }
+        }
+
+        statistics.acmr = static_cast<float>(misses) / static_cast<float>(mesh.triangleCount);
+        statistics.atvr = static_cast<float>(misses) / static_cast<float>(usedCount);
+        return statistics;
+    }
+protected:
+    friend class MeshClusters;
+
+    static constexpr unsigned int noVertex = ~0u;
+    static constexpr unsigned int fifoCacheSize = 16;
+    static constexpr size_t forsythCacheSize = 32;
+
+    /**
+     * Symmetric 4x4 matrix summing the squared distances to weighted planes.
+     */
+    struct Quadric {
+        double a2{0.0}, b2{0.0}, c2{0.0}, d2{0.0}, ab{0.0}, ac{0.0}, ad{0.0}, bc{0.0}, bd{0.0}, cd{0.0};
+        double weight{0.0};
+
+        /**
+         * Plane of the triangle, weighted by its area.
+         */
+        static Quadric FromTriangle(const float* p0, const float* p1, const float* p2) {
+            const double ux = p1[0] - p0[0], uy = p1[1] - p0[1], uz = p1[2] - p0[2];
+            const double vx = p2[0] - p0[0], vy = p2[1] - p0[1], vz = p2[2] - p0[2];
+            double a = uy * vz - uz * vy;
+            double b = uz * vx - ux * vz;
+            double c = ux * vy - uy * vx;
+            const double length = std::sqrt(a * a + b * b + c * c);
+            if (length == 0.0) {
+                return {};
+            }
+            a /= length;
+            b /= length;
+            c /= length;
+            const double d = -(a * p0[0] + b * p0[1] + c * p0[2]);
+            const double w = length * 0.5;
+            return {a * a * w, b * b * w, c * c * w, d * d * w, a * b * w, a * c * w, a * d * w, b * c * w,
+                    b * d * w, c * d * w, w};
+        }
+
+        Quadric& operator+=(const Quadric& other) {
+            a2 += other.a2;
+            b2 += other.b2;
+            c2 += other.c2;
+            d2 += other.d2;
+            ab += other.ab;
+            ac += other.ac;
+            ad += other.ad;
+            bc += other.bc;
+            bd += other.bd;
+            cd += other.cd;
+            weight += other.weight;
+            return *this;
+        }
+
+        /**
+         * Weighted mean squared distance of the point to the planes.
+         */
+        [[nodiscard]] double Error(const float* p) const {
+            const double x = p[0], y = p[1], z = p[2];
+            const double error = a2 * x * x + b2 * y * y + c2 * z * z + d2 +
+                                 2.0 * (ab * x * y + ac * x * z + ad * x + bc * y * z + bd * y + cd * z);
+            return weight > 0.0 ? std::max(error, 0.0) / weight : 0.0;
+        }
+    };
+
+    /**
+     * Edge collapse moving vertex from onto vertex to.
+     */
+    struct Collapse {
+        unsigned int from;
+        unsigned int to;
+        double cost;
+    };
+
+    /**
+     * Triangles using each vertex, as offsets into one array.
+     */
+    template<typename Index>
+    static void BuildAdjacency(std::span<const Index> indices, size_t vertexCount, std::vector<unsigned int>& offsets,
+            std::vector<unsigned int>& adjacency) {
+        offsets.assign(vertexCount + 1, 0);
+        for (Index index : indices) {
+            offsets[index + size_t{1}]++;
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        adjacency.resize(indices.size());
+        std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < indices.size(); i++) {
+            adjacency[fill[indices[i]]++] = static_cast<unsigned int>(i / 3);
+        }
+    }
+
+    /**
+     * Whether every edge around the vertex is shared by exactly two triangles of opposite winding.
+     *
+     * Borders, attribute seams and non-manifold edges all fail this test.
+     */
+    static bool IsManifoldVertex(unsigned int vertex, const std::vector<unsigned int>& indices,
+            const std::vector<unsigned int>& offsets, const std::vector<unsigned int>& adjacency) {
+        // Each triangle leaves the vertex along one edge and enters it along another: they must pair up
+        unsigned int pending[64];
+        size_t pendingCount = 0;
+        for (unsigned int i = offsets[vertex]; i < offsets[vertex + 1]; i++) {
+            const size_t t = adjacency[i] * size_t{3};
+            const size_t k = indices[t] == vertex ? 0 : indices[t + 1] == vertex ? 1 : 2;
+            const unsigned int next = indices[t + (k + 1) % 3];
+            const unsigned int previous = indices[t + (k + 2) % 3];
+            for (const auto& [neighbour, flag] : {std::pair{next, 0u}, std::pair{previous, 1u}}) {
+                const unsigned int key = neighbour * 2 + flag;
+                const unsigned int match = neighbour * 2 + (flag ^ 1u);
+                unsigned int* end = pending + pendingCount;
+                unsigned int* found = std::find(pending, end, match);
+                if (found != end) {
+                    *found = pending[--pendingCount];
+                } else if (pendingCount == 64 || std::find(pending, end, key) != end) {
+                    return false;
+                } else {
+                    pending[pendingCount++] = key;
+                }
+            }
+        }
+        return pendingCount == 0;
+    }
+
+    /**
+     * Whether moving the vertex would turn one of its remaining triangles over.
+     */
+    static bool FlipsTriangle(const Collapse& collapse, const std::vector<float>& positions,
+            const std::vector<unsigned int>& indices, const std::vector<unsigned int>& offsets,
+            const std::vector<unsigned int>& adjacency) {
+        const auto normal = [&positions](unsigned int a, unsigned int b, const float* c, double* n) {
+            const float* pa = &positions[a * size_t{3}];
+            const float* pb = &positions[b * size_t{3}];
+            const double ux = pb[0] - pa[0], uy = pb[1] - pa[1], uz = pb[2] - pa[2];
+            const double vx = c[0] - pa[0], vy = c[1] - pa[1], vz = c[2] - pa[2];
+            n[0] = uy * vz - uz * vy;
+            n[1] = uz * vx - ux * vz;
+            n[2] = ux * vy - uy * vx;
+        };
+
+        for (unsigned int i = offsets[collapse.from]; i < offsets[collapse.from + 1]; i++) {
+            const size_t t = adjacency[i] * size_t{3};
+            const size_t k = indices[t] == collapse.from ? 0 : indices[t + 1] == collapse.from ? 1 : 2;
+            const unsigned int b = indices[t + (k + 1) % 3];
+            const unsigned int c = indices[t + (k + 2) % 3];
+            if (b == collapse.to || c == collapse.to) {
+                continue;
+            }
+
+            double before[3];
+            double after[3];
+            normal(b, c, &positions[collapse.from * size_t{3}], before);
+            normal(b, c, &positions[collapse.to * size_t{3}], after);
+            const double dot = before[0] * after[0] + before[1] * after[1] + before[2] * after[2];
+            const double lengths = (before[0] * before[0] + before[1] * before[1] + before[2] * before[2]) *
+                                   (after[0] * after[0] + after[1] * after[1] + after[2] * after[2]);
+            if (dot <= 0.25 * std::sqrt(lengths)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static void RemoveDegenerateTriangles(std::vector<unsigned int>& indices) {
+        size_t output = 0;
+        for (size_t t = 0; t < indices.size(); t += 3) {
+            const unsigned int a = indices[t], b = indices[t + 1], c = indices[t + 2];
+            if (a != b && b != c && c != a) {
+                indices[output++] = a;
+                indices[output++] = b;
+                indices[output++] = c;
+            }
+        }
+        indices.resize(output);
+    }
+
+    /**
+     * Positions scaled so that the largest side of the bounding box is 1.
+     */
+    static std::vector<float> LoadNormalizedPositions(const ::Mesh& mesh) {
+        std::vector<float> positions(mesh.vertices, mesh.vertices + static_cast<size_t>(mesh.vertexCount) * 3);
+        float min[3] = {positions[0], positions[1], positions[2]};
+        float max[3] = {positions[0], positions[1], positions[2]};
+        for (size_t i = 0; i < positions.size(); i++) {
+            min[i % 3] = std::min(min[i % 3], positions[i]);
+            max[i % 3] = std::max(max[i % 3], positions[i]);
+        }
+        const float extent = std::max({max[0] - min[0], max[1] - min[1], max[2] - min[2]});
+        const float scale = extent > 0.0f ? 1.0f / extent : 1.0f;
+        for (size_t i = 0; i < positions.size(); i++) {
+            positions[i] = (positions[i] - min[i % 3]) * scale;
+        }
+        return positions;
+    }
+
+    /**
+     * Keeps the vertices used by the 32-bit indices, in order of first use, indexed if they fit in 16 bits.
+     */
+    static void StoreIndices(::Mesh& mesh, std::vector<unsigned int>& indices) {
+        std::vector<unsigned int> remap(static_cast<size_t>(mesh.vertexCount), noVertex);
+        std::vector<unsigned int> order;
+        for (unsigned int& index : indices) {
+            if (remap[index] == noVertex) {
+                remap[index] = static_cast<unsigned int>(order.size());
+                order.push_back(index);
+            }
+            index = remap[index];
+        }
+
+        if (order.size() <= 65536) {
+            RemapVertices(mesh, order);
+            SetIndices(mesh, indices);
+            return;
+        }
+
+        // Too many vertices for 16-bit indices: three vertices per triangle instead
+        for (unsigned int& index : indices) {
+            index = order[index];
+        }
+        RemapVertices(mesh, indices);
+        RL_FREE(mesh.indices);
+        mesh.indices = nullptr;
+        mesh.triangleCount = static_cast<int>(indices.size() / 3);
+    }
+
+    /**
+     * Calls function(data, components) for every per-vertex attribute of the mesh.
+     */
+    template<typename MeshType, typename Function>
+    static void ForEachAttribute(MeshType& mesh, Function&& function) {
+        function(mesh.vertices, 3);
+        function(mesh.texcoords, 2);
+        function(mesh.texcoords2, 2);
+        function(mesh.normals, 3);
+        function(mesh.tangents, 4);
+        function(mesh.colors, 4);
+        function(mesh.animVertices, 3);
+        function(mesh.animNormals, 3);
+        function(mesh.boneIds, 4);
+        function(mesh.boneWeights, 4);
+    }
+
+    /**
+     * Maps every vertex to the slot of its first identical vertex, unique lists the vertex of each slot.
+     */
+    static std::vector<unsigned int> GenerateRemap(const ::Mesh& mesh, std::vector<unsigned int>& unique) {
+        const auto vertexCount = static_cast<size_t>(mesh.vertexCount);
+
+        // Open addressing hash table over the bytes of all attributes of a vertex
+        size_t tableSize = 1;
+        while (tableSize < vertexCount * 2) {
+            tableSize *= 2;
+        }
+        std::vector<unsigned int> table(tableSize, noVertex);
+        std::vector<unsigned int> remap(vertexCount);
+        unique.clear();
+        unique.reserve(vertexCount);
+        for (size_t i = 0; i < vertexCount; i++) {
+            for (size_t slot = HashVertex(mesh, i) & (tableSize - 1);; slot = (slot + 1) & (tableSize - 1)) {
+                if (table[slot] == noVertex) {
+                    table[slot] = static_cast<unsigned int>(unique.size());
+                    remap[i] = static_cast<unsigned int>(unique.size());
+                    unique.push_back(static_cast<unsigned int>(i));
+                    break;
+                }
+                if (VerticesEqual(mesh, unique[table[slot]], i)) {
+                    remap[i] = table[slot];
+                    break;
+                }
+            }
+        }
+        return remap;
+    }
+
+    static uint64_t HashVertex(const ::Mesh& mesh, size_t vertex) {
+        uint64_t hash = 14695981039346656037ull;
+        ForEachAttribute(mesh, [&](const auto* data, size_t components) {
+            if (data == nullptr) {
+                return;
+            }
+            const auto* bytes = reinterpret_cast<const unsigned char*>(data + vertex * components);
+            for (size_t i = 0; i < components * sizeof(*data); i++) {
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+            }
+        });
+        return hash;
+    }
+
+    static bool VerticesEqual(const ::Mesh& mesh, size_t a, size_t b) {
+        bool equal = true;
+        ForEachAttribute(mesh, [&](const auto* data, size_t components) {
+            if (equal && data != nullptr) {
+                equal = memcmp(data + a * components, data + b * components, components * sizeof(*data)) == 0;
+            }
+        });
+        return equal;
+    }
+
+    /**
+     * Replaces every attribute with the vertices listed in order.
+     */
+    static void RemapVertices(::Mesh& mesh, std::span<const unsigned int> order) {
+        ForEachAttribute(mesh, [&](auto*& data, size_t components) {
+            if (data == nullptr) {
+                return;
+            }
+            using Type = std::remove_reference_t<decltype(*data)>;
+            const size_t size = std::max<size_t>(order.size(), 1) * components * sizeof(Type);
+            auto* remapped = static_cast<Type*>(RL_MALLOC(size));
+            for (size_t i = 0; i < order.size(); i++) {
+                memcpy(remapped + i * components, data + order[i] * components, components * sizeof(Type));
+            }
+            RL_FREE(data);
+            data = remapped;
+        });
+        mesh.vertexCount = static_cast<int>(order.size());
+    }
+
+    static void SetIndices(::Mesh& mesh, std::span<const unsigned int> indices) {
+        RL_FREE(mesh.indices);
+        mesh.indices = static_cast<unsigned short*>( // NOLINT
+            RL_MALLOC(std::max<size_t>(indices.size(), 1) * sizeof(unsigned short))); // NOLINT
+        for (size_t i = 0; i < indices.size(); i++) {
+            mesh.indices[i] = static_cast<unsigned short>(indices[i]); // NOLINT
+        }
+        mesh.triangleCount = static_cast<int>(indices.size() / 3);
+    }
+
+    /**
+     * Forsyth's vertex score: recently used vertices and vertices with few remaining triangles score higher.
+     */
+    static float ForsythScore(int cachePosition, unsigned int remaining) {
+        if (remaining == 0) {
+            return -1.0f;
+        }
+
+        float score = 0.0f;
+        if (cachePosition >= 0) {
+            if (cachePosition < 3) {
+                // The last triangle's vertices get a fixed score, so the next one does not simply repeat them
+                score = 0.75f;
+            } else {
+                const float scale = 1.0f / static_cast<float>(forsythCacheSize - 3);
+                score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scale, 1.5f);
+            }
+        }
+        return score + 2.0f / std::sqrt(static_cast<float>(remaining));
+    }
+
+    static void UpdateScores(
+        unsigned int vertex,
+        int cachePosition,
+        const std::vector<unsigned int>& offsets,
+        const std::vector<unsigned int>& adjacency,
+        const std::vector<unsigned int>& remaining,
+        std::vector<float>& vertexScore,
+        std::vector<float>& triangleScore) {
+        const float score = ForsythScore(cachePosition, remaining[vertex]);
+        const float delta = score - vertexScore[vertex];
+        vertexScore[vertex] = score;
+        if (delta == 0.0f) {
+            return;
+        }
+        for (unsigned int i = 0; i < remaining[vertex]; i++) {
+            triangleScore[adjacency[offsets[vertex] + i]] += delta;
+        }
+    }
+};
+} // namespace raylib
+
+using RMeshOptimizer = raylib::MeshOptimizer;
+
+#endif // RAYLIB_CPP_INCLUDE_MESHOPTIMIZER_HPP_
@@ -1,11 +1,15 @@
 #ifndef RAYLIB_CPP_INCLUDE_MESHUNMANAGED_HPP_
 #define RAYLIB_CPP_INCLUDE_MESHUNMANAGED_HPP_
 
+#include <span>
 #include <string>
 #include <vector>
 
 #include "./BoundingBox.hpp"
+#include "./BoundingSphere.hpp"
 #include "./Matrix.hpp"
+#include "./MeshBuilder.hpp"
+#include "./MeshOptimizer.hpp"
 #include "./Model.hpp"
 #include "./raylib-cpp-utils.hpp"
 
@@ -70,101 +74,52 @@ public:
         return ::GenMeshPlane(width, length, resX, resZ);
     }
 
+    /**
+     * Generate plane mesh (with subdivisions), with texture coordinates repeating textureScale times
+     */
     static MeshUnmanaged Plane(float width, float length, int resX, int resZ, float textureScale) {
-        ::Mesh mesh = {};
-
         resX++;
         resZ++;
 
-        // Vertices definition
-        int vertexCount = resX*resZ; // vertices get reused for the faces
-
-        Vector3 *vertices = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
-        for (int z = 0; z < resZ; z++)
-        {
-            // [-length/2, length/2]
-            float zPos = ((float)z/(resZ - 1) - 0.5f)*length;
-            for (int x = 0; x < resX; x++)
-            {
-                // [-width/2, width/2]
-                float xPos = ((float)x/(resX - 1) - 0.5f)*width;
-                vertices[x + z*resX] = Vector3{ xPos, 0.0f, zPos };
+        // Vertices get reused for the faces
+        MeshBuilder builder(resX * resZ, (resX - 1) * (resZ - 1) * 2);
+        std::span<raylib::Vector3> positions = builder.Positions();
+        std::span<raylib::Vector3> normals = builder.Normals();
+        std::span<raylib::Vector2> texcoords = builder.TexCoords();
+        for (int z = 0; z < resZ; z++) {
+            const float v = static_cast<float>(z) / static_cast<float>(resZ - 1);
+            for (int x = 0; x < resX; x++) {
+                const float u = static_cast<float>(x) / static_cast<float>(resX - 1);
+                const auto i = static_cast<size_t>(x + z * resX);
+                positions[i] = raylib::Vector3((u - 0.5f) * width, 0.0f, (v - 0.5f) * length);
+                normals[i] = raylib::Vector3(0.0f, 1.0f, 0.0f);
+                texcoords[i] = raylib::Vector2(u * textureScale, v * textureScale);
             }
         }
 
-        // Normals definition
-        Vector3 *normals = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
-        for (int n = 0; n < vertexCount; n++) normals[n] = Vector3{ 0.0f, 1.0f, 0.0f };   // Vector3.up;
-
-        // TexCoords definition
-        Vector2 *texcoords = (Vector2 *)RL_MALLOC(vertexCount*sizeof(Vector2));
-        for (int v = 0; v < resZ; v++)
-        {
-            for (int u = 0; u < resX; u++)
-            {
-                texcoords[u + v*resX] = Vector2{ (float)u/(resX - 1), (float)v/(resZ - 1) };
+        std::span<unsigned short> indices = builder.Indices(); // NOLINT
+        size_t t = 0;
+        for (int z = 0; z < resZ - 1; z++) {
+            for (int x = 0; x < resX - 1; x++) {
+                // Lower left corner of the face
+                const auto i = static_cast<unsigned short>(x + z * resX); // NOLINT
+                const auto right = static_cast<unsigned short>(i + 1); // NOLINT
+                const auto up = static_cast<unsigned short>(i + resX); // NOLINT
+                const auto upRight = static_cast<unsigned short>(up + 1); // NOLINT
+
+                indices[t++] = up;
+                indices[t++] = right;
+                indices[t++] = i;
+
+                indices[t++] = up;
+                indices[t++] = upRight;
+                indices[t++] = right;
             }
         }
 
-        // Triangles definition (indices)
-        int numFaces = (resX - 1)*(resZ - 1);
-        int *triangles = (int *)RL_MALLOC(numFaces*6*sizeof(int));
-        int t = 0;
-        for (int face = 0; face < numFaces; face++)
-        {
-            // Retrieve lower left corner from face ind
-            int i = face % (resX - 1) + (face/(resZ - 1)*resX);
-
-            triangles[t++] = i + resX;
-            triangles[t++] = i + 1;
-            triangles[t++] = i;
-
-            triangles[t++] = i + resX;
-            triangles[t++] = i + resX + 1;
-            triangles[t++] = i + 1;
-        }
-
-        mesh.vertexCount = vertexCount;
-        mesh.triangleCount = numFaces*2;
-        mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-        mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
-        mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-        mesh.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
-
-        // Mesh vertices position array
-        for (int i = 0; i < mesh.vertexCount; i++)
-        {
-            mesh.vertices[3*i] = vertices[i].x;
-            mesh.vertices[3*i + 1] = vertices[i].y;
-            mesh.vertices[3*i + 2] = vertices[i].z;
-        }
-
-        // Mesh texcoords array
-        for (int i = 0; i < mesh.vertexCount; i++)
-        {
-            mesh.texcoords[2*i] = texcoords[i].x * textureScale;
-            mesh.texcoords[2*i + 1] = texcoords[i].y * textureScale;
-        }
-
-        // Mesh normals array
-        for (int i = 0; i < mesh.vertexCount; i++)
-        {
-            mesh.normals[3*i] = normals[i].x;
-            mesh.normals[3*i + 1] = normals[i].y;
-            mesh.normals[3*i + 2] = normals[i].z;
-        }
-
-        // Mesh indices array initialization
-        for (int i = 0; i < mesh.triangleCount*3; i++) mesh.indices[i] = triangles[i];
-
-        RL_FREE(vertices);
-        RL_FREE(normals);
-        RL_FREE(texcoords);
-        RL_FREE(triangles);
-
         // Upload vertex data to GPU (static mesh)
-        UploadMesh(&mesh, false);
-
+        ::Mesh mesh = builder.Build();
+        ::UploadMesh(&mesh, false);
         return mesh;
     }
 
@@ -231,9 +186,9 @@ public:
         return ::GenMeshCubicmap(cubicmap, cubeSize);
     }
 
-    GETTERSETTER(int, VertexCount, vertexCount)
+    GETTER(int, VertexCount, vertexCount)
     GETTERSETTER(int, TriangleCount, triangleCount)
-    GETTERSETTER(float*, Vertices, vertices)
+    GETTER(float*, Vertices, vertices)
     GETTERSETTER(float*, TexCoords, texcoords)
     GETTERSETTER(float*, TexCoords2, texcoords2)
     GETTERSETTER(float*, Normals, normals)
@@ -247,6 +202,16 @@ public:
     GETTERSETTER(unsigned int, VaoId, vaoId)
     GETTERSETTER(unsigned int*, VboId, vboId)
 
+    void SetVertexCount(int value) {
+        vertexCount = value;
+        InvalidateBounds();
+    }
+
+    void SetVertices(float* value) {
+        vertices = value;
+        InvalidateBounds();
+    }
+
     MeshUnmanaged& operator=(const ::Mesh& mesh) {
         set(mesh);
         return *this;
@@ -256,22 +221,30 @@ public:
      * Unload mesh from memory (RAM and/or VRAM)
      */
     void Unload() {
-        if (vboId != nullptr) {
+        // Meshes built on the CPU only, i.e. with MeshBuilder, have vertex data but no buffers yet.
+        if (vboId != nullptr || vertices != nullptr) {
             ::UnloadMesh(*this);
-            vboId = nullptr;
+            set(::Mesh{});
         }
     }
 
     /**
      * Upload mesh vertex data to GPU (VRAM)
      */
-    void Upload(bool dynamic = false) { ::UploadMesh(this, dynamic); }
+    void Upload(bool dynamic = false) {
+        ::UploadMesh(this, dynamic);
+        InvalidateBounds();
+    }
 
     /**
      * Upload mesh vertex data to GPU (VRAM)
      */
     void UpdateBuffer(int index, void* data, int dataSize, int offset = 0) {
         ::UpdateMeshBuffer(*this, index, data, dataSize, offset);
+        // Buffer 0 holds the positions, see ::UploadMesh()
+        if (index == 0) {
+            InvalidateBounds();
+        }
     }
 
     /**
@@ -309,38 +282,40 @@ public:
     }
 
     /**
-     * Compute mesh bounding box limits
+     * Compute mesh bounding box limits, once until the vertex data changes.
+     *
+     * Setting or uploading the vertices, or changing the vertex count, is noticed. Call InvalidateBounds() after
+     * editing the vertices in place.
      */
-    [[nodiscard]] raylib::BoundingBox BoundingBox() const { return ::GetMeshBoundingBox(*this); }
+    [[nodiscard]] raylib::BoundingBox BoundingBox() const {
+        UpdateBounds();
+        return bounds;
+    }
 
     /**
-     * Compute mesh bounding box limits with respect to the given transformation
+     * Compute the sphere around the mesh, centered on its bounding box, once until the vertex data changes.
      */
-    raylib::BoundingBox GetTransformedBoundingBox(::Matrix transform) const {
-        // Get min and max vertex to construct bounds (AABB)
-        raylib::Vector3 minVertex = { 0 };
-        raylib::Vector3 maxVertex = { 0 };
-
-        if (vertices != NULL)
-        {
-            minVertex = raylib::Vector3{ vertices[0], vertices[1], vertices[2] }.Transform(transform);
-            maxVertex = raylib::Vector3{ vertices[0], vertices[1], vertices[2] }.Transform(transform);
-
-            for (int i = 1; i < vertexCount; i++)
-            {
-                minVertex = Vector3Min(minVertex, raylib::Vector3{ vertices[i*3], vertices[i*3 + 1], vertices[i*3 + 2] }.Transform(transform));
-                maxVertex = Vector3Max(maxVertex, raylib::Vector3{ vertices[i*3], vertices[i*3 + 1], vertices[i*3 + 2] }.Transform(transform));
-            }
-        }
-
-        // Create the bounding box
-        raylib::BoundingBox box = {};
-        box.min = minVertex;
-        box.max = maxVertex;
+    [[nodiscard]] raylib::BoundingSphere GetBoundingSphere() const {
+        UpdateBounds();
+        return sphere;
+    }
 
-        return box;
+    /**
+     * Compute mesh bounding box limits with respect to the given transformation, from the cached local box.
+     *
+     * Transforms the corners of the local bounding box rather than every vertex, so the result is larger than the
+     * tightest box under rotation.
+     */
+    [[nodiscard]] raylib::BoundingBox GetTransformedBoundingBox(::Matrix transform) const {
+        UpdateBounds();
+        return bounds.Transform(transform);
     }
 
+    /**
+     * Recompute the bounds on the next request, after the vertices were edited in place.
+     */
+    void InvalidateBounds() { boundsVertices = nullptr; }
+
     /**
      * Compute mesh tangents
      */
@@ -349,6 +324,74 @@ public:
         return *this;
     }
 
+    /**
+     * Merge vertices that are identical in all attributes, indexing the mesh
+     *
+     * @see raylib::MeshOptimizer::Weld()
+     */
+    MeshUnmanaged& Weld() {
+        MeshOptimizer::Weld(*this);
+        InvalidateBounds();
+        return *this;
+    }
+
+    /**
+     * Reorder triangles for the post-transform vertex cache
+     */
+    MeshUnmanaged& OptimizeVertexCache() {
+        MeshOptimizer::OptimizeVertexCache(*this);
+        return *this;
+    }
+
+    /**
+     * Reorder triangle clusters to reduce overdraw, keeping the vertex cache miss ratio within threshold
+     */
+    MeshUnmanaged& OptimizeOverdraw(float threshold = 1.05f) {
+        MeshOptimizer::OptimizeOverdraw(*this, threshold);
+        return *this;
+    }
+
+    /**
+     * Reorder vertices by first use in the index buffer
+     */
+    MeshUnmanaged& OptimizeVertexFetch() {
+        MeshOptimizer::OptimizeVertexFetch(*this);
+        InvalidateBounds();
+        return *this;
+    }
+
+    /**
+     * Weld and run all reordering passes on the vertex data in RAM, before Upload()
+     *
+     * @see raylib::MeshOptimizer::Optimize()
+     */
+    MeshUnmanaged& Optimize(float overdrawThreshold = 1.05f) {
+        MeshOptimizer::Optimize(*this, overdrawThreshold);
+        InvalidateBounds();
+        return *this;
+    }
+
+    /**
+     * Reduce the triangle count by quadric error edge collapses, keeping borders and attribute seams
+     *
+     * @param targetRatio Fraction of the triangles to keep.
+     * @param maxError Largest allowed distance to the original surface, relative to the size of the mesh.
+     *
+     * @see raylib::MeshOptimizer::Simplify()
+     */
+    MeshUnmanaged& Simplify(float targetRatio, float maxError = 0.01f) {
+        MeshOptimizer::Simplify(*this, targetRatio, maxError);
+        InvalidateBounds();
+        return *this;
+    }
+
+    /**
+     * Simulate the post-transform vertex cache to get the ACMR and ATVR of the index buffer
+     */
+    [[nodiscard]] MeshOptimizer::VertexCacheStatistics AnalyzeVertexCache(unsigned int cacheSize = 16) const {
+        return MeshOptimizer::AnalyzeVertexCache(*this, cacheSize);
+    }
+
     /**
      * Load model from generated mesh
      */
@@ -365,6 +408,25 @@ public:
     bool IsValid() { return ::IsModelValid(*this); }
 
 protected:
+    void UpdateBounds() const {
+        if (vertices == boundsVertices && vertexCount == boundsVertexCount) {
+            return;
+        }
+
+        const auto count = static_cast<size_t>(vertexCount);
+        bounds = raylib::BoundingBox::FromPoints(vertices, count);
+        sphere = raylib::BoundingSphere::FromPoints(vertices, count, bounds);
+        boundsVertices = vertices;
+        boundsVertexCount = vertexCount;
+    }
+
+    void setBounds(const MeshUnmanaged& other) {
+        bounds = other.bounds;
+        sphere = other.sphere;
+        boundsVertices = other.boundsVertices;
+        boundsVertexCount = other.boundsVertexCount;
+    }
+
     void set(const ::Mesh& mesh) {
         vertexCount = mesh.vertexCount;
         triangleCount = mesh.triangleCount;
@@ -382,35 +444,14 @@ protected:
         boneMatrices = mesh.boneMatrices;
         vaoId = mesh.vaoId;
         vboId = mesh.vboId;
-    }
-};
-
-inline BoundingBox Model::GetTransformedBoundingBox() const {
-    BoundingBox bounds = {};
-
-    if (meshCount > 0)
-    {
-        Vector3 temp = { 0 };
-        bounds = (*(raylib::MeshUnmanaged*)(&meshes[0])).GetTransformedBoundingBox(transform);
-
-        for (int i = 1; i < meshCount; i++)
-        {
-            BoundingBox tempBounds = (*(raylib::MeshUnmanaged*)(&meshes[i])).GetTransformedBoundingBox(transform);
-
-            temp.x = (bounds.min.x < tempBounds.min.x)? bounds.min.x : tempBounds.min.x;
-            temp.y = (bounds.min.y < tempBounds.min.y)? bounds.min.y : tempBounds.min.y;
-            temp.z = (bounds.min.z < tempBounds.min.z)? bounds.min.z : tempBounds.min.z;
-            bounds.min = temp;
-
-            temp.x = (bounds.max.x > tempBounds.max.x)? bounds.max.x : tempBounds.max.x;
-            temp.y = (bounds.max.y > tempBounds.max.y)? bounds.max.y : tempBounds.max.y;
-            temp.z = (bounds.max.z > tempBounds.max.z)? bounds.max.z : tempBounds.max.z;
-            bounds.max = temp;
-        }
+        InvalidateBounds();
     }
 
-    return bounds;
-}
+    mutable raylib::BoundingBox bounds{};
+    mutable raylib::BoundingSphere sphere{};
+    mutable const float* boundsVertices{nullptr};
+    mutable int boundsVertexCount{0};
+};
 }  // namespace raylib
 
 using RMeshUnmanaged = raylib::MeshUnmanaged;
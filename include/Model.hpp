@@ -1,8 +1,11 @@
 #ifndef RAYLIB_CPP_INCLUDE_MODEL_HPP_
 #define RAYLIB_CPP_INCLUDE_MODEL_HPP_
 
+#include <cstring>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "./RaylibException.hpp"
 #include "./raylib-cpp-utils.hpp"
@@ -15,6 +18,7 @@
 
 namespace raylib {
 class Mesh;
+class ModelLoadJob;
 /**
  * Model type
  */
@@ -62,6 +66,7 @@ public:
 
     Model(Model&& other) noexcept {
         set(other);
+        setBounds(std::move(other));
 
         other.meshCount = 0;
         other.materialCount = 0;
@@ -97,6 +102,7 @@ public:
 
         Unload();
         set(other);
+        setBounds(std::move(other));
 
         other.meshCount = 0;
         other.materialCount = 0;
@@ -119,6 +125,7 @@ public:
             meshes = nullptr;
             materials = nullptr;
         }
+        InvalidateBounds();
     }
 
     /**
@@ -197,9 +204,47 @@ public:
 
     /**
      * Compute model bounding box limits with respect to the Model's transformation (considers all meshes)
-     * This function is pretty expensive!
+     *
+     * The local box of each mesh is computed once and transformed in constant time, and the result is reused while
+     * neither the transform nor the meshes change. Call InvalidateBounds() after editing vertices in place.
+     */
+    [[nodiscard]] BoundingBox GetTransformedBoundingBox() const {
+        bool changed = !transformedBoundsValid || memcmp(&transform, &boundsTransform, sizeof(::Matrix)) != 0;
+        if (meshBounds.size() != static_cast<size_t>(meshCount)) {
+            meshBounds.resize(static_cast<size_t>(meshCount));
+            changed = true;
+        }
+
+        for (size_t i = 0; i < meshBounds.size(); i++) {
+            const ::Mesh& mesh = meshes[i];
+            MeshBounds& cached = meshBounds[i];
+            if (cached.vertices != mesh.vertices || cached.vertexCount != mesh.vertexCount) {
+                cached.box = BoundingBox::FromPoints(mesh.vertices, static_cast<size_t>(mesh.vertexCount));
+                cached.vertices = mesh.vertices;
+                cached.vertexCount = mesh.vertexCount;
+                changed = true;
+            }
+        }
+
+        if (changed) {
+            transformedBounds = BoundingBox();
+            for (size_t i = 0; i < meshBounds.size(); i++) {
+                const BoundingBox box = meshBounds[i].box.Transform(transform);
+                transformedBounds = i == 0 ? box : transformedBounds.Merge(box);
+            }
+            boundsTransform = transform;
+            transformedBoundsValid = true;
+        }
+        return transformedBounds;
+    }
+
+    /**
+     * Recompute the bounds on the next request, after the vertices of a mesh were edited in place.
      */
-    BoundingBox GetTransformedBoundingBox() const;
+    void InvalidateBounds() {
+        meshBounds.clear();
+        transformedBoundsValid = false;
+    }
 
     /**
      * Compute model bounding box limits (considers all meshes)
@@ -230,6 +275,49 @@ public:
         }
     }
 
+    /**
+     * Loads a Model from a raylib-cpp binary file, copying the attributes out of the mapped file.
+     *
+     * Defined in ModelBinary.hpp, which keeps the mapped file headers out of this one, so include it to call this.
+     *
+     * @throws raylib::RaylibException Throws if the file is missing, truncated or of another version.
+     *
+     * @see raylib::ModelBinary, raylib::MappedModel
+     */
+    void LoadBinary(const std::string_view fileName);
+
+    /**
+     * Export the model as a raylib-cpp binary file, which loads without parsing. Defined in ModelBinary.hpp.
+     *
+     * @throws raylib::RaylibException Throws if failed to export the Model.
+     */
+    void ExportBinary(const std::string_view fileName) const;
+
+    /**
+     * Load a model through a directory of binary conversions, converting the source file again when its contents
+     * change. Defined in ModelBinary.hpp.
+     *
+     * @throws raylib::RaylibException Throws if failed to load the Model.
+     */
+    static Model LoadCached(const std::string_view fileName, const std::string_view cacheDirectory);
+
+    /**
+     * Start loading a .rlmodel file without stalling the render thread, call Update() on the job every frame until
+     * done. Defined in ModelLoadJob.hpp, which keeps the ThreadPool and mapped file headers out of this one.
+     *
+     * @throws raylib::RaylibException Throws if the file is in another format, which needs a cache directory.
+     *
+     * @see raylib::ModelLoadJob
+     */
+    static ModelLoadJob LoadAsync(const std::string_view fileName);
+
+    /**
+     * Start loading any model format through a cache directory of binary conversions. Defined in ModelLoadJob.hpp.
+     *
+     * @see raylib::ModelLoadJob, Model::LoadCached()
+     */
+    static ModelLoadJob LoadAsync(const std::string_view fileName, const std::string_view cacheDirectory);
+
     /**
      * Loads a Model from the given Mesh.
      *
@@ -254,7 +342,28 @@ protected:
         boneCount = model.boneCount;
         bones = model.bones;
         bindPose = model.bindPose;
+
+        InvalidateBounds();
     }
+
+    void setBounds(Model&& other) {
+        meshBounds = std::move(other.meshBounds);
+        boundsTransform = other.boundsTransform;
+        transformedBounds = other.transformedBounds;
+        transformedBoundsValid = other.transformedBoundsValid;
+        other.InvalidateBounds();
+    }
+
+    struct MeshBounds {
+        const float* vertices{nullptr};
+        int vertexCount{0};
+        BoundingBox box{};
+    };
+
+    mutable std::vector<MeshBounds> meshBounds{};
+    mutable ::Matrix boundsTransform{};
+    mutable BoundingBox transformedBounds{};
+    mutable bool transformedBoundsValid{false};
 };
 
 } // namespace raylib
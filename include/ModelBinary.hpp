@@ -0,0 +1,563 @@
+#ifndef RAYLIB_CPP_INCLUDE_MODELBINARY_HPP_
+#define RAYLIB_CPP_INCLUDE_MODELBINARY_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "./MappedFile.hpp"
+#include "./Model.hpp"
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * raylib-cpp binary model format, laid out so the mesh attributes can be used in place after mapping the file.
+ *
+ * A file holds a header, a record per mesh and per material, then every attribute array, bone and texture 16 byte
+ * aligned. Numbers are stored in the byte order of the machine that exported the file, loading a file from the other
+ * byte order fails the version check. Materials keep their map colors, values and textures, but not their shader.
+ *
+ * Not included by Model.hpp, as it maps files with the platform's mmap headers. It defines the binary members of
+ * Model, so include it to call them.
+ *
+ * @code
+ * raylib::Model("level.glb").ExportBinary("level.rlmodel");
+ * raylib::Model level;
+ * level.LoadBinary("level.rlmodel");
+ * @endcode
+ *
+ * @see Model::ExportBinary(), Model::LoadBinary(), Model::LoadCached(), raylib::MappedModel, raylib::ModelLoadJob
+ */
+class ModelBinary {
+public:
+    /** Extension used for cached conversions */
+    static constexpr const char* extension = ".rlmodel";
+
+    /**
+     * Write the model, including its textures when embedTextures is set, which reads them back from the GPU.
+     *
+     * @param sourceHash Hash of the asset the model was converted from, for LoadCached().
+     *
+     * @throws raylib::RaylibException Throws if the file could not be written.
+     */
+    static void Export(
+        const ::Model& model,
+        const std::string_view fileName,
+        uint64_t sourceHash = 0,
+        bool embedTextures = true) {
+        std::vector<unsigned char> file = Serialize(model, sourceHash, embedTextures);
+        if (file.size() > static_cast<size_t>(INT32_MAX) ||
+            !::SaveFileData(std::string(fileName).c_str(), file.data(), static_cast<int>(file.size()))) {
+            throw RaylibException("Failed to export the Model to " + std::string(fileName));
+        }
+    }
+
+    /**
+     * Load a model, copying the attributes out of the mapped file into memory owned by the model.
+     *
+     * @param verify Check the content hash too, which reads the whole file.
+     *
+     * @throws raylib::RaylibException Throws if the file is missing, truncated or of another version.
+     */
+    static ::Model Load(const std::string_view fileName, bool verify = false, bool upload = true) {
+        const MappedFile file(fileName);
+        return Load(file, true, verify, upload);
+    }
+
+    /**
+     * Build a model from a mapped file.
+     *
+     * @param copy Copy the attributes, otherwise point the meshes straight into the file, which must then outlive
+     * the model and be detached with Detach() before the model is unloaded.
+     */
+    static ::Model Load(const MappedFile& file, bool copy, bool verify = false, bool upload = true) {
+        const unsigned char* data = file.GetData();
+        const Header& header = Validate(file, verify);
+        const auto* meshRecords = reinterpret_cast<const MeshRecord*>(data + sizeof(Header));
+        const auto* materialRecords = reinterpret_cast<const MaterialRecord*>(meshRecords + header.meshCount);
+
+        ::Model model{};
+        memcpy(&model.transform, header.transform, sizeof(model.transform));
+
+        model.meshCount = static_cast<int>(header.meshCount);
+        model.meshes = static_cast<::Mesh*>(RL_CALLOC(header.meshCount, sizeof(::Mesh)));
+        model.meshMaterial = static_cast<int*>(RL_CALLOC(header.meshCount, sizeof(int)));
+        for (uint32_t i = 0; i < header.meshCount; i++) {
+            const MeshRecord& record = meshRecords[i];
+            ::Mesh& mesh = model.meshes[i];
+            mesh.vertexCount = record.vertexCount;
+            mesh.triangleCount = record.triangleCount;
+            const bool knownMaterial =
+                record.material >= 0 && static_cast<uint32_t>(record.material) < header.materialCount;
+            model.meshMaterial[i] = knownMaterial ? record.material : 0;
+
+            const auto attribute = [&](size_t index) -> void* {
+                const Blob& blob = record.attributes[index];
+                return blob.size == 0 ? nullptr : copy ? Copy(data, blob) : file.GetData() + blob.offset;
+            };
+            mesh.vertices = static_cast<float*>(attribute(Vertices));
+            mesh.texcoords = static_cast<float*>(attribute(TexCoords));
+            mesh.texcoords2 = static_cast<float*>(attribute(TexCoords2));
+            mesh.normals = static_cast<float*>(attribute(Normals));
+            mesh.tangents = static_cast<float*>(attribute(Tangents));
+            mesh.colors = static_cast<unsigned char*>(attribute(Colors));
+            mesh.indices = static_cast<unsigned short*>(attribute(Indices));
+            mesh.boneIds = static_cast<unsigned char*>(attribute(BoneIds));
+            mesh.boneWeights = static_cast<float*>(attribute(BoneWeights));
+
+            // The animated copies are written by CPU skinning, so they are always owned by the mesh
+            if (mesh.vertices != nullptr && mesh.boneIds != nullptr && mesh.boneWeights != nullptr) {
+                const size_t size = static_cast<size_t>(mesh.vertexCount) * 3 * sizeof(float);
+                mesh.animVertices = static_cast<float*>(RL_MALLOC(size));
+                memcpy(mesh.animVertices, mesh.vertices, size);
+                if (mesh.normals != nullptr) {
+                    mesh.animNormals = static_cast<float*>(RL_MALLOC(size));
+                    memcpy(mesh.animNormals, mesh.normals, size);
+                }
+            }
+            if (record.boneCount > 0) {
+                mesh.boneCount = record.boneCount;
+                mesh.boneMatrices =
+                    static_cast<::Matrix*>(RL_CALLOC(static_cast<size_t>(record.boneCount), sizeof(::Matrix)));
+                for (int bone = 0; bone < record.boneCount; bone++) {
+                    mesh.boneMatrices[bone].m0 = 1.0f;
+                    mesh.boneMatrices[bone].m5 = 1.0f;
+                    mesh.boneMatrices[bone].m10 = 1.0f;
+                    mesh.boneMatrices[bone].m15 = 1.0f;
+                }
+            }
+
+            if (upload) {
+                ::UploadMesh(&mesh, mesh.animVertices != nullptr);
+            }
+        }
+
+        // raylib expects at least the default material
+        model.materialCount = static_cast<int>(header.materialCount > 0 ? header.materialCount : 1);
+        model.materials =
+            static_cast<::Material*>(RL_CALLOC(static_cast<size_t>(model.materialCount), sizeof(::Material)));
+        for (int i = 0; i < model.materialCount; i++) {
+            model.materials[i] = ::LoadMaterialDefault();
+        }
+        for (uint32_t i = 0; i < header.materialCount; i++) {
+            const MaterialRecord& record = materialRecords[i];
+            ::Material& material = model.materials[i];
+            memcpy(material.params, record.params, sizeof(material.params));
+            for (size_t map = 0; material.maps != nullptr && map < materialMapCount; map++) {
+                const MapRecord& mapRecord = record.maps[map];
+                const unsigned char* color = mapRecord.color;
+                material.maps[map].color = {color[0], color[1], color[2], color[3]};
+                material.maps[map].value = mapRecord.value;
+                if (upload && mapRecord.image.size > 0) {
+                    // Uploading reads the pixels straight out of the file
+                    ::Image image{
+                        file.GetData() + mapRecord.image.offset,
+                        mapRecord.width,
+                        mapRecord.height,
+                        mapRecord.mipmaps,
+                        mapRecord.format};
+                    material.maps[map].texture = ::LoadTextureFromImage(image);
+                }
+            }
+        }
+
+        model.boneCount = static_cast<int>(header.boneCount);
+        model.bones = static_cast<::BoneInfo*>(Copy(data, header.bones));
+        model.bindPose = static_cast<::Transform*>(Copy(data, header.bindPose));
+        return model;
+    }
+
+    /**
+     * Texture embedded in a file, decoded for uploading to a material map.
+     */
+    struct TextureImage {
+        int material{0};
+        int map{0};
+        ::Image image{};
+    };
+
+    /**
+     * Copy the embedded textures out of a mapped file, for models loaded with upload = false.
+     *
+     * The images are owned by the caller, unload them with ::UnloadImage().
+     */
+    static std::vector<TextureImage> LoadImages(const MappedFile& file) {
+        const Header& header = Validate(file, false);
+        const auto* materialRecords = reinterpret_cast<const MaterialRecord*>(
+            file.GetData() + sizeof(Header) + header.meshCount * sizeof(MeshRecord));
+
+        std::vector<TextureImage> images;
+        for (uint32_t i = 0; i < header.materialCount; i++) {
+            for (size_t map = 0; map < materialMapCount; map++) {
+                const MapRecord& record = materialRecords[i].maps[map];
+                if (record.image.size > 0) {
+                    const ::Image image{
+                        Copy(file.GetData(), record.image),
+                        record.width,
+                        record.height,
+                        record.mipmaps,
+                        record.format};
+                    images.push_back({static_cast<int>(i), static_cast<int>(map), image});
+                }
+            }
+        }
+        return images;
+    }
+
+    /**
+     * Clear the attribute pointers of a model loaded with copy = false, so ::UnloadModel() leaves the file alone.
+     */
+    static void Detach(::Model& model) {
+        for (int i = 0; model.meshes != nullptr && i < model.meshCount; i++) {
+            ::Mesh& mesh = model.meshes[i];
+            mesh.vertices = nullptr;
+            mesh.texcoords = nullptr;
+            mesh.texcoords2 = nullptr;
+            mesh.normals = nullptr;
+            mesh.tangents = nullptr;
+            mesh.colors = nullptr;
+            mesh.indices = nullptr;
+            mesh.boneIds = nullptr;
+            mesh.boneWeights = nullptr;
+        }
+    }
+
+    /**
+     * Hash of the source asset stored by Export(), or 0 when the file is not a valid model.
+     */
+    [[nodiscard]] static uint64_t GetSourceHash(const std::string_view fileName) {
+        try {
+            const MappedFile file(fileName);
+            return Validate(file, false).sourceHash;
+        } catch (const RaylibException&) {
+            return 0;
+        }
+    }
+
+    /**
+     * 64-bit FNV-1a hash
+     */
+    [[nodiscard]] static uint64_t Hash(std::span<const unsigned char> data, uint64_t hash = 14695981039346656037ull) {
+        for (const unsigned char byte : data) {
+            hash = (hash ^ byte) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /**
+     * Path of the conversion of the source file in the cache directory, named after the hash of its contents.
+     *
+     * @param sourceHash Receives the hash of the source file.
+     *
+     * @throws raylib::RaylibException Throws if the source file could not be read.
+     */
+    static std::string GetCacheFile(
+        const std::string_view sourceFile,
+        const std::string_view cacheDirectory,
+        uint64_t& sourceHash) {
+        const std::string source(sourceFile);
+        {
+            const MappedFile sourceData(source);
+            sourceHash = Hash(sourceData.GetSpan());
+        }
+
+        // Not ::GetFileNameWithoutExt(), whose static buffer would be shared with other threads
+        const size_t slash = source.find_last_of("/\\");
+        std::string name = source.substr(slash == std::string::npos ? 0 : slash + 1);
+        name = name.substr(0, name.rfind('.'));
+
+        char hashText[17];
+        snprintf(hashText, sizeof(hashText), "%016llx", static_cast<unsigned long long>(sourceHash));
+        return std::string(cacheDirectory) + "/" + name + "-" + hashText + extension;
+    }
+
+    /**
+     * Load a model through a cache of binary conversions, keyed on the hash of the source file.
+     *
+     * Only the source file itself is hashed, so files it references, like the buffers of a .gltf, need a changed
+     * source file to trigger a new conversion.
+     *
+     * @throws raylib::RaylibException Throws if the source could not be loaded.
+     */
+    static ::Model LoadCached(const std::string_view sourceFile, const std::string_view cacheDirectory) {
+        const std::string source(sourceFile);
+        const std::string directory(cacheDirectory);
+        uint64_t sourceHash = 0;
+        const std::string cacheFile = GetCacheFile(source, directory, sourceHash);
+
+        if (::FileExists(cacheFile.c_str()) && GetSourceHash(cacheFile) == sourceHash) {
+            try {
+                return Load(cacheFile);
+            } catch (const RaylibException&) {
+                // Convert again below
+            }
+        }
+
+        ::Model model = ::LoadModel(source.c_str());
+        if (model.meshes == nullptr) {
+            throw RaylibException("Failed to load Model from " + source);
+        }
+        if (!::DirectoryExists(directory.c_str())) {
+            ::MakeDirectory(directory.c_str());
+        }
+        try {
+            Export(model, cacheFile, sourceHash);
+        } catch (const RaylibException&) {
+            // A read-only cache still leaves a loaded model
+        }
+        return model;
+    }
+protected:
+    enum Attribute { Vertices, TexCoords, TexCoords2, Normals, Tangents, Colors, Indices, BoneIds, BoneWeights };
+
+    static constexpr size_t attributeCount = 9;
+    static constexpr size_t materialMapCount = MATERIAL_MAP_BRDF + 1;
+    static constexpr size_t alignment = 16;
+    static constexpr uint32_t version = 1;
+    static constexpr char magic[8] = {'R', 'L', 'C', 'P', 'P', 'M', 'D', 'L'};
+
+    /** Range of the file, offset 16 byte aligned */
+    struct Blob {
+        uint64_t offset{0};
+        uint64_t size{0};
+    };
+
+    struct Header {
+        char magic[8]{};
+        uint32_t version{0};
+        uint32_t meshCount{0};
+        uint32_t materialCount{0};
+        uint32_t boneCount{0};
+        uint64_t sourceHash{0};
+        /** Hash of everything after the header */
+        uint64_t contentHash{0};
+        float transform[16]{};
+        Blob bones{};
+        Blob bindPose{};
+    };
+
+    struct MeshRecord {
+        int32_t vertexCount{0};
+        int32_t triangleCount{0};
+        int32_t boneCount{0};
+        int32_t material{0};
+        Blob attributes[attributeCount]{};
+    };
+
+    struct MapRecord {
+        unsigned char color[4]{};
+        float value{0.0f};
+        int32_t width{0};
+        int32_t height{0};
+        int32_t mipmaps{0};
+        int32_t format{0};
+        Blob image{};
+    };
+
+    struct MaterialRecord {
+        float params[4]{};
+        MapRecord maps[materialMapCount]{};
+    };
+
+    static std::vector<unsigned char> Serialize(const ::Model& model, uint64_t sourceHash, bool embedTextures) {
+        const auto meshCount = static_cast<size_t>(std::max(model.meshCount, 0));
+        const auto materialCount =
+            static_cast<size_t>(model.materials != nullptr ? std::max(model.materialCount, 0) : 0);
+        std::vector<unsigned char> file(sizeof(Header) + meshCount * sizeof(MeshRecord) +
+                                        materialCount * sizeof(MaterialRecord));
+        const auto append = [&file](const void* data, size_t size) {
+            Blob blob;
+            if (data == nullptr || size == 0) {
+                return blob;
+            }
+            file.resize((file.size() + alignment - 1) / alignment * alignment);
+            blob.offset = file.size();
+            blob.size = size;
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            file.insert(file.end(), bytes, bytes + size);
+            return blob;
+        };
+
+        Header header;
+        memcpy(header.magic, magic, sizeof(magic));
+        header.version = version;
+        header.meshCount = static_cast<uint32_t>(meshCount);
+        header.materialCount = static_cast<uint32_t>(materialCount);
+        header.boneCount = static_cast<uint32_t>(model.bones != nullptr ? std::max(model.boneCount, 0) : 0);
+        header.sourceHash = sourceHash;
+        memcpy(header.transform, &model.transform, sizeof(header.transform));
+        header.bones = append(model.bones, header.boneCount * sizeof(::BoneInfo));
+        header.bindPose = append(model.bindPose, header.boneCount * sizeof(::Transform));
+
+        std::vector<MeshRecord> meshRecords(meshCount);
+        for (size_t i = 0; i < meshCount; i++) {
+            const ::Mesh& mesh = model.meshes[i];
+            MeshRecord& record = meshRecords[i];
+            record.vertexCount = mesh.vertexCount;
+            record.triangleCount = mesh.triangleCount;
+            record.boneCount = mesh.boneMatrices != nullptr ? mesh.boneCount : 0;
+            record.material = model.meshMaterial != nullptr ? model.meshMaterial[i] : 0;
+            size_t sizes[attributeCount];
+            GetAttributeSizes(record, sizes);
+            const void* attributes[attributeCount] = {
+                mesh.vertices,
+                mesh.texcoords,
+                mesh.texcoords2,
+                mesh.normals,
+                mesh.tangents,
+                mesh.colors,
+                mesh.indices,
+                mesh.boneIds,
+                mesh.boneWeights};
+            for (size_t a = 0; a < attributeCount; a++) {
+                record.attributes[a] = append(attributes[a], sizes[a]);
+            }
+        }
+
+        std::vector<MaterialRecord> materialRecords(materialCount);
+        for (size_t i = 0; i < materialCount; i++) {
+            const ::Material& material = model.materials[i];
+            MaterialRecord& record = materialRecords[i];
+            memcpy(record.params, material.params, sizeof(record.params));
+            for (size_t map = 0; material.maps != nullptr && map < materialMapCount; map++) {
+                const ::MaterialMap& materialMap = material.maps[map];
+                MapRecord& mapRecord = record.maps[map];
+                mapRecord.color[0] = materialMap.color.r;
+                mapRecord.color[1] = materialMap.color.g;
+                mapRecord.color[2] = materialMap.color.b;
+                mapRecord.color[3] = materialMap.color.a;
+                mapRecord.value = materialMap.value;
+                if (!embedTextures || materialMap.texture.id == 0) {
+                    continue;
+                }
+
+                ::Image image = ::LoadImageFromTexture(materialMap.texture);
+                if (image.data != nullptr) {
+                    mapRecord.width = image.width;
+                    mapRecord.height = image.height;
+                    mapRecord.mipmaps = 1;
+                    mapRecord.format = image.format;
+                    const int size = ::GetPixelDataSize(image.width, image.height, image.format);
+                    mapRecord.image = append(image.data, static_cast<size_t>(std::max(size, 0)));
+                }
+                ::UnloadImage(image);
+            }
+        }
+
+        unsigned char* records = file.data() + sizeof(Header);
+        std::copy_n(
+            reinterpret_cast<const unsigned char*>(meshRecords.data()),
+            meshCount * sizeof(MeshRecord),
+            records);
+        std::copy_n(
+            reinterpret_cast<const unsigned char*>(materialRecords.data()),
+            materialCount * sizeof(MaterialRecord),
+            records + meshCount * sizeof(MeshRecord));
+        header.contentHash = Hash(std::span<const unsigned char>(file).subspan(sizeof(Header)));
+        memcpy(file.data(), &header, sizeof(Header));
+        return file;
+    }
+
+    static void GetAttributeSizes(const MeshRecord& record, size_t* sizes) {
+        const auto vertexCount = static_cast<size_t>(std::max(record.vertexCount, 0));
+        sizes[Vertices] = vertexCount * 3 * sizeof(float);
+        sizes[TexCoords] = vertexCount * 2 * sizeof(float);
+        sizes[TexCoords2] = vertexCount * 2 * sizeof(float);
+        sizes[Normals] = vertexCount * 3 * sizeof(float);
+        sizes[Tangents] = vertexCount * 4 * sizeof(float);
+        sizes[Colors] = vertexCount * 4 * sizeof(unsigned char);
+        sizes[Indices] = static_cast<size_t>(std::max(record.triangleCount, 0)) * 3 * sizeof(unsigned short);
+        sizes[BoneIds] = vertexCount * 4 * sizeof(unsigned char);
+        sizes[BoneWeights] = vertexCount * 4 * sizeof(float);
+    }
+
+    /**
+     * Check the header and that every record and range lies within the file, so the pointers handed out are safe.
+     */
+    static const Header& Validate(const MappedFile& file, bool verify) {
+        const unsigned char* data = file.GetData();
+        const size_t size = file.GetSize();
+        if (size < sizeof(Header)) {
+            throw RaylibException("Model file is too small");
+        }
+        const Header& header = *reinterpret_cast<const Header*>(data);
+        if (memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != version) {
+            throw RaylibException("Model file has an unknown format or version");
+        }
+
+        const uint64_t recordsSize = uint64_t{header.meshCount} * sizeof(MeshRecord) +
+                                     uint64_t{header.materialCount} * sizeof(MaterialRecord);
+        if (recordsSize > size - sizeof(Header)) {
+            throw RaylibException("Model file is truncated");
+        }
+        // Optional arrays may be left out, the skeleton and the vertex positions are required by their counts
+        const auto inFile = [size](const Blob& blob, uint64_t expectedSize, bool required = false) {
+            if (blob.size == 0) {
+                return !required || expectedSize == 0;
+            }
+            return blob.size == expectedSize && blob.offset % alignment == 0 && blob.offset <= size &&
+                   blob.size <= size - blob.offset;
+        };
+
+        bool valid = inFile(header.bones, uint64_t{header.boneCount} * sizeof(::BoneInfo), true) &&
+                     inFile(header.bindPose, uint64_t{header.boneCount} * sizeof(::Transform), true);
+        const auto* meshRecords = reinterpret_cast<const MeshRecord*>(data + sizeof(Header));
+        for (uint32_t i = 0; valid && i < header.meshCount; i++) {
+            size_t sizes[attributeCount];
+            GetAttributeSizes(meshRecords[i], sizes);
+            for (size_t a = 0; a < attributeCount; a++) {
+                valid = valid && inFile(meshRecords[i].attributes[a], sizes[a], a == Vertices);
+            }
+        }
+        const auto* materialRecords = reinterpret_cast<const MaterialRecord*>(meshRecords + header.meshCount);
+        for (uint32_t i = 0; valid && i < header.materialCount; i++) {
+            for (const MapRecord& map : materialRecords[i].maps) {
+                const int imageSize = ::GetPixelDataSize(map.width, map.height, map.format);
+                valid = valid && inFile(map.image, static_cast<uint64_t>(std::max(imageSize, 0)));
+            }
+        }
+        if (!valid) {
+            throw RaylibException("Model file is truncated or corrupted");
+        }
+
+        if (verify && Hash(file.GetSpan().subspan(sizeof(Header))) != header.contentHash) {
+            throw RaylibException("Model file does not match its content hash");
+        }
+        return header;
+    }
+
+    static void* Copy(const unsigned char* data, const Blob& blob) {
+        if (blob.size == 0) {
+            return nullptr;
+        }
+        void* copy = RL_MALLOC(blob.size);
+        memcpy(copy, data + blob.offset, blob.size);
+        return copy;
+    }
+};
+
+inline void Model::LoadBinary(const std::string_view fileName) {
+    Unload();
+    set(ModelBinary::Load(fileName));
+}
+
+inline void Model::ExportBinary(const std::string_view fileName) const {
+    ModelBinary::Export(*this, fileName);
+}
+
+inline Model Model::LoadCached(const std::string_view fileName, const std::string_view cacheDirectory) {
+    return Model(ModelBinary::LoadCached(fileName, cacheDirectory));
+}
+} // namespace raylib
+
+using RModelBinary = raylib::ModelBinary;
+
+#endif // RAYLIB_CPP_INCLUDE_MODELBINARY_HPP_
@@ -0,0 +1,360 @@
+#ifndef RAYLIB_CPP_INCLUDE_MODELLOADJOB_HPP_
+#define RAYLIB_CPP_INCLUDE_MODELLOADJOB_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "./MappedFile.hpp"
+#include "./Model.hpp"
+#include "./ModelBinary.hpp"
+#include "./RaylibException.hpp"
+#include "./ThreadPool.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Model loaded in two halves: parsed and decoded on a worker thread, then uploaded to the GPU by Update() on the
+ * render thread, a few meshes and textures per frame.
+ *
+ * Worker threads parse raylib-cpp binary models (.rlmodel). raylib's own loaders upload while parsing, so other
+ * formats need a cache directory of binary conversions, as in ModelBinary::LoadCached(): a worker hashes the source
+ * and parses its conversion when there is one. Otherwise the first Update() after the hash converts the source once
+ * on the render thread, stalling it for the whole ::LoadModel(), then the conversion is parsed like any other.
+ *
+ * Not included by Model.hpp, as it brings in the ThreadPool and the mapped file loader, and defines
+ * Model::LoadAsync().
+ *
+ * @code
+ * raylib::ModelLoadJob job = raylib::Model::LoadAsync("level.glb", "cache");
+ * ...
+ * if (job.Update(0.002f)) {
+ *     raylib::Model level = job.Take();
+ * }
+ * @endcode
+ *
+ * @see raylib::ModelBinary
+ */
+class ModelLoadJob {
+public:
+    /**
+     * GPU uploads done on the render thread, replaceable to load models without a graphics context.
+     */
+    struct Uploader {
+        /** Upload a mesh, the flag is set for meshes animated on the CPU */
+        std::function<void(::Mesh&, bool)> mesh{};
+        std::function<::Texture2D(const ::Image&)> texture{};
+    };
+
+    ModelLoadJob() = default;
+
+    /**
+     * Start parsing a .rlmodel file on a worker thread of the default pool.
+     *
+     * @throws raylib::RaylibException Throws if the file is in another format, which needs a cache directory.
+     */
+    explicit ModelLoadJob(const std::string_view fileName) : ModelLoadJob(fileName, Uploader()) {}
+
+    /**
+     * Start parsing a .rlmodel file on a worker thread of the pool.
+     *
+     * @throws raylib::RaylibException Throws if the file is in another format, which needs a cache directory.
+     */
+    ModelLoadJob(
+        const std::string_view fileName,
+        Uploader uploader,
+        ThreadPool& pool = ThreadPool::GetDefault())
+        : fileName(fileName),
+          cacheDirectory(),
+          uploader(std::move(uploader)),
+          pool(&pool) {
+        if (!::IsFileExtension(this->fileName.c_str(), ModelBinary::extension)) {
+            throw RaylibException("ModelLoadJob needs a cache directory to convert " + this->fileName);
+        }
+        Start();
+    }
+
+    /**
+     * Start loading any model format through a cache directory of binary conversions on the default pool.
+     */
+    ModelLoadJob(const std::string_view fileName, const std::string_view cacheDirectory)
+        : ModelLoadJob(fileName, cacheDirectory, Uploader()) {}
+
+    /**
+     * Start loading any model format through a cache directory of binary conversions, hashing the source and parsing
+     * its conversion on a worker thread of the pool.
+     */
+    ModelLoadJob(
+        const std::string_view fileName,
+        const std::string_view cacheDirectory,
+        Uploader uploader,
+        ThreadPool& pool = ThreadPool::GetDefault())
+        : fileName(fileName),
+          cacheDirectory(cacheDirectory),
+          uploader(std::move(uploader)),
+          pool(&pool) {
+        Start();
+    }
+
+    ModelLoadJob(const ModelLoadJob&) = delete;
+    ModelLoadJob& operator=(const ModelLoadJob&) = delete;
+
+    ModelLoadJob(ModelLoadJob&& other) noexcept
+        : fileName(std::move(other.fileName)),
+          cacheDirectory(std::move(other.cacheDirectory)),
+          uploader(std::move(other.uploader)),
+          pool(other.pool),
+          parsing(std::move(other.parsing)),
+          result(std::move(other.result)),
+          parsed(other.parsed),
+          nextMesh(other.nextMesh),
+          nextImage(other.nextImage) {
+        other.result = Parsed();
+        other.parsed = false;
+    }
+
+    ModelLoadJob& operator=(ModelLoadJob&& other) noexcept {
+        if (this != &other) {
+            Unload();
+            fileName = std::move(other.fileName);
+            cacheDirectory = std::move(other.cacheDirectory);
+            uploader = std::move(other.uploader);
+            pool = other.pool;
+            parsing = std::move(other.parsing);
+            result = std::move(other.result);
+            parsed = other.parsed;
+            nextMesh = other.nextMesh;
+            nextImage = other.nextImage;
+            other.result = Parsed();
+            other.parsed = false;
+        }
+        return *this;
+    }
+
+    /**
+     * Waits for the worker thread and unloads the model, unless it was taken.
+     */
+    ~ModelLoadJob() { Unload(); }
+
+    /**
+     * Upload the parsed model for up to budget seconds, but at least one mesh or texture per call.
+     *
+     * A single large mesh may overrun the budget, as it is uploaded in one go.
+     *
+     * @return Whether the model is ready to Take().
+     *
+     * @throws raylib::RaylibException Throws if the model could not be loaded.
+     */
+    bool Update(float budget = 0.002f) {
+        if (!parsed && !Parse()) {
+            return false;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const std::chrono::duration<float> limit(budget);
+        while (!IsDone()) {
+            if (nextMesh < static_cast<size_t>(result.model.meshCount)) {
+                ::Mesh& mesh = result.model.meshes[nextMesh++];
+                uploader.mesh(mesh, mesh.animVertices != nullptr);
+            } else {
+                ModelBinary::TextureImage& texture = result.images[nextImage++];
+                ::Material& material = result.model.materials[texture.material];
+                material.maps[texture.map].texture = uploader.texture(texture.image);
+                ::UnloadImage(texture.image);
+                texture.image.data = nullptr;
+            }
+            if (std::chrono::steady_clock::now() - start >= limit) {
+                break;
+            }
+        }
+        return IsDone();
+    }
+
+    /**
+     * Whether the worker thread finished parsing, Update() still uploads.
+     */
+    [[nodiscard]] bool IsParsed() const {
+        return parsed || (parsing.valid() && parsing.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    }
+
+    /**
+     * Whether every mesh and texture is uploaded.
+     */
+    [[nodiscard]] bool IsDone() const {
+        return parsed && nextMesh >= static_cast<size_t>(result.model.meshCount) && nextImage >= result.images.size();
+    }
+
+    /**
+     * Share of the uploads done, from 0 until parsed to 1 when done.
+     */
+    [[nodiscard]] float GetProgress() const {
+        if (!parsed) {
+            return 0.0f;
+        }
+        const size_t total = static_cast<size_t>(result.model.meshCount) + result.images.size();
+        return total > 0 ? static_cast<float>(nextMesh + nextImage) / static_cast<float>(total) : 1.0f;
+    }
+
+    [[nodiscard]] const std::string& GetFileName() const { return fileName; }
+
+    /**
+     * Hand the loaded model over, the caller unloads it.
+     *
+     * @throws raylib::RaylibException Throws if the model is not done uploading.
+     */
+    ::Model Take() {
+        if (!IsDone() || result.model.meshes == nullptr) {
+            throw RaylibException("Model " + fileName + " is not loaded yet");
+        }
+        ::Model model = result.model;
+        result = Parsed();
+        return model;
+    }
+
+    /**
+     * Wait for the worker thread, then unload everything that was not taken.
+     */
+    void Unload() {
+        if (parsing.valid()) {
+            try {
+                result = parsing.get();
+            } catch (...) {
+                // Nothing was loaded, and Update() reported the error if it was ever called
+            }
+        }
+        for (ModelBinary::TextureImage& texture : result.images) {
+            ::UnloadImage(texture.image);
+        }
+        if (result.model.meshes != nullptr || result.model.materials != nullptr) {
+            ::UnloadModel(result.model);
+        }
+        result = Parsed();
+        parsed = false;
+        nextMesh = 0;
+        nextImage = 0;
+    }
+protected:
+    struct Parsed {
+        ::Model model{};
+        std::vector<ModelBinary::TextureImage> images{};
+        /** Conversion the source still needs, when it is not in the cache yet */
+        std::string cacheFile{};
+        uint64_t sourceHash{0};
+    };
+
+    void Start() {
+        if (!uploader.mesh) {
+            uploader.mesh = [](::Mesh& mesh, bool dynamic) { ::UploadMesh(&mesh, dynamic); };
+        }
+        if (!uploader.texture) {
+            uploader.texture = [](const ::Image& image) { return ::LoadTextureFromImage(image); };
+        }
+
+        if (cacheDirectory.empty()) {
+            parsing = pool->Submit([path = fileName] { return Read(path); });
+            return;
+        }
+        parsing = pool->Submit([source = fileName, directory = cacheDirectory] {
+            uint64_t sourceHash = 0;
+            std::string cacheFile = ModelBinary::GetCacheFile(source, directory, sourceHash);
+            if (ModelBinary::GetSourceHash(cacheFile) == sourceHash) {
+                try {
+                    return Read(cacheFile);
+                } catch (const RaylibException&) {
+                    // Convert again
+                }
+            }
+            Parsed result;
+            result.cacheFile = std::move(cacheFile);
+            result.sourceHash = sourceHash;
+            return result;
+        });
+    }
+
+    static Parsed Read(const std::string& path) {
+        const MappedFile file(path);
+        Parsed result;
+        result.model = ModelBinary::Load(file, true, false, false);
+        result.images = ModelBinary::LoadImages(file);
+        return result;
+    }
+
+    /**
+     * Collect the parsed model once the worker thread is done, converting a source missing from the cache first.
+     */
+    bool Parse() {
+        if (!parsing.valid()) {
+            throw RaylibException("Failed to load Model from " + fileName);
+        }
+        if (parsing.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return false;
+        }
+        result = parsing.get();
+        if (!result.cacheFile.empty()) {
+            return Convert();
+        }
+        parsed = true;
+        return true;
+    }
+
+    /**
+     * Convert the source into the cache on the render thread, as ::LoadModel() uploads, then parse the conversion
+     * on a worker thread.
+     */
+    bool Convert() {
+        const std::string cacheFile = std::move(result.cacheFile);
+        const uint64_t sourceHash = result.sourceHash;
+        result = Parsed();
+
+        ::Model model = ::LoadModel(fileName.c_str());
+        if (!::IsModelValid(model)) {
+            ::UnloadModel(model);
+            throw RaylibException("Failed to load Model from " + fileName);
+        }
+        try {
+            if (!::DirectoryExists(cacheDirectory.c_str())) {
+                ::MakeDirectory(cacheDirectory.c_str());
+            }
+            ModelBinary::Export(model, cacheFile, sourceHash);
+        } catch (const RaylibException&) {
+            // A read-only cache still leaves the model, which ::LoadModel() already uploaded
+            result.model = model;
+            nextMesh = static_cast<size_t>(model.meshCount);
+            parsed = true;
+            return true;
+        }
+        ::UnloadModel(model);
+        parsing = pool->Submit([cacheFile] { return Read(cacheFile); });
+        return false;
+    }
+
+    std::string fileName{};
+    std::string cacheDirectory{};
+    Uploader uploader{};
+    ThreadPool* pool{nullptr};
+    std::future<Parsed> parsing{};
+    Parsed result{};
+    bool parsed{false};
+    size_t nextMesh{0};
+    size_t nextImage{0};
+};
+
+inline ModelLoadJob Model::LoadAsync(const std::string_view fileName) {
+    return ModelLoadJob(fileName);
+}
+
+inline ModelLoadJob Model::LoadAsync(const std::string_view fileName, const std::string_view cacheDirectory) {
+    return ModelLoadJob(fileName, cacheDirectory);
+}
+} // namespace raylib
+
+using RModelLoadJob = raylib::ModelLoadJob;
+
+#endif // RAYLIB_CPP_INCLUDE_MODELLOADJOB_HPP_
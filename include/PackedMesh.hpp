@@ -0,0 +1,314 @@
+#ifndef RAYLIB_CPP_INCLUDE_PACKEDMESH_HPP_
+#define RAYLIB_CPP_INCLUDE_PACKEDMESH_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Compact copy of the vertex data of a mesh, for storing and streaming meshes.
+ *
+ * - Positions: 3 x 16-bit unsigned, normalized to the bounding box of the mesh
+ * - Normals: octahedral 2 x 16-bit signed, normalized
+ * - Tangents: octahedral 2 x 16-bit signed, with the bitangent sign in the lowest bit of the second component
+ * - Texture coordinates: 2 x half float
+ * - Colors and indices: unchanged
+ *
+ * That is 22 instead of 56 bytes per vertex when all float attributes are present. Animation data is not packed.
+ *
+ * @code
+ * raylib::PackedMesh packed(mesh);
+ * ...
+ * raylib::Mesh unpacked(packed.Unpack());
+ * unpacked.Upload();
+ * @endcode
+ */
+class PackedMesh {
+public:
+    PackedMesh() = default;
+
+    /**
+     * Pack the vertex data of a mesh, see Pack()
+     */
+    explicit PackedMesh(const ::Mesh& mesh) { Pack(mesh); }
+
+    GETTER(int, VertexCount, vertexCount)
+    GETTER(int, TriangleCount, triangleCount)
+    GETTER(::BoundingBox, Bounds, bounds)
+
+    /**
+     * Quantize the vertex data of a mesh, which must still be in RAM.
+     */
+    void Pack(const ::Mesh& mesh) {
+        vertexCount = mesh.vertices != nullptr ? mesh.vertexCount : 0;
+        triangleCount = mesh.triangleCount;
+        const auto count = static_cast<size_t>(vertexCount);
+        positions.clear();
+        normals.clear();
+        tangents.clear();
+        texcoords.clear();
+        texcoords2.clear();
+        colors.clear();
+        indices.clear();
+        bounds = {};
+        if (count == 0) {
+            return;
+        }
+
+        bounds.min = bounds.max = {mesh.vertices[0], mesh.vertices[1], mesh.vertices[2]};
+        for (size_t i = 0; i < count; i++) {
+            const float* p = mesh.vertices + i * 3;
+            bounds.min = {std::min(bounds.min.x, p[0]), std::min(bounds.min.y, p[1]), std::min(bounds.min.z, p[2])};
+            bounds.max = {std::max(bounds.max.x, p[0]), std::max(bounds.max.y, p[1]), std::max(bounds.max.z, p[2])};
+        }
+        const float extent[3] = {bounds.max.x - bounds.min.x, bounds.max.y - bounds.min.y, bounds.max.z - bounds.min.z};
+        const float min[3] = {bounds.min.x, bounds.min.y, bounds.min.z};
+        positions.resize(count * 3);
+        for (size_t i = 0; i < count * 3; i++) {
+            const float scale = extent[i % 3] > 0.0f ? 65535.0f / extent[i % 3] : 0.0f;
+            positions[i] = static_cast<uint16_t>(std::lround((mesh.vertices[i] - min[i % 3]) * scale));
+        }
+
+        if (mesh.normals != nullptr) {
+            normals.resize(count * 2);
+            for (size_t i = 0; i < count; i++) {
+                const float* n = mesh.normals + i * 3;
+                EncodeOctahedral({n[0], n[1], n[2]}, &normals[i * 2]);
+            }
+        }
+        if (mesh.tangents != nullptr) {
+            tangents.resize(count * 2);
+            for (size_t i = 0; i < count; i++) {
+                const float* t = mesh.tangents + i * 4;
+                EncodeOctahedral({t[0], t[1], t[2]}, &tangents[i * 2]);
+                const auto y = static_cast<uint16_t>(tangents[i * 2 + 1]);
+                tangents[i * 2 + 1] = static_cast<int16_t>((y & 0xFFFEu) | (t[3] < 0.0f ? 1u : 0u));
+            }
+        }
+        PackHalf(mesh.texcoords, count * 2, texcoords);
+        PackHalf(mesh.texcoords2, count * 2, texcoords2);
+        if (mesh.colors != nullptr) {
+            colors.assign(mesh.colors, mesh.colors + count * 4);
+        }
+        if (mesh.indices != nullptr) {
+            indices.assign(mesh.indices, mesh.indices + static_cast<size_t>(triangleCount) * 3);
+        }
+    }
+
+    /**
+     * Decode into a new mesh with its vertex data in RAM, not uploaded to the GPU.
+     */
+    [[nodiscard]] ::Mesh Unpack() const {
+        ::Mesh mesh{};
+        mesh.vertexCount = vertexCount;
+        mesh.triangleCount = triangleCount;
+        const auto count = static_cast<size_t>(vertexCount);
+        if (count == 0) {
+            return mesh;
+        }
+
+        mesh.vertices = static_cast<float*>(RL_MALLOC(count * 3 * sizeof(float)));
+        for (size_t i = 0; i < count; i++) {
+            const ::Vector3 p = DecodePosition(&positions[i * 3], bounds);
+            mesh.vertices[i * 3] = p.x;
+            mesh.vertices[i * 3 + 1] = p.y;
+            mesh.vertices[i * 3 + 2] = p.z;
+        }
+        if (!normals.empty()) {
+            mesh.normals = static_cast<float*>(RL_MALLOC(count * 3 * sizeof(float)));
+            for (size_t i = 0; i < count; i++) {
+                const ::Vector3 n = DecodeOctahedral(&normals[i * 2]);
+                mesh.normals[i * 3] = n.x;
+                mesh.normals[i * 3 + 1] = n.y;
+                mesh.normals[i * 3 + 2] = n.z;
+            }
+        }
+        if (!tangents.empty()) {
+            mesh.tangents = static_cast<float*>(RL_MALLOC(count * 4 * sizeof(float)));
+            for (size_t i = 0; i < count; i++) {
+                const ::Vector3 t = DecodeOctahedral(&tangents[i * 2]);
+                mesh.tangents[i * 4] = t.x;
+                mesh.tangents[i * 4 + 1] = t.y;
+                mesh.tangents[i * 4 + 2] = t.z;
+                mesh.tangents[i * 4 + 3] = (tangents[i * 2 + 1] & 1) != 0 ? -1.0f : 1.0f;
+            }
+        }
+        mesh.texcoords = UnpackHalf(texcoords);
+        mesh.texcoords2 = UnpackHalf(texcoords2);
+        mesh.colors = UnpackCopy(colors);
+        mesh.indices = UnpackCopy(indices);
+        return mesh;
+    }
+
+    /**
+     * Size of the packed vertex and index data, in bytes
+     */
+    [[nodiscard]] size_t GetDataSize() const {
+        return positions.size() * sizeof(uint16_t) + normals.size() * sizeof(int16_t) +
+               tangents.size() * sizeof(int16_t) + texcoords.size() * sizeof(uint16_t) +
+               texcoords2.size() * sizeof(uint16_t) + colors.size() + indices.size() * sizeof(uint16_t);
+    }
+
+    [[nodiscard]] std::span<const uint16_t> GetPositions() const { return positions; }
+    [[nodiscard]] std::span<const int16_t> GetNormals() const { return normals; }
+    [[nodiscard]] std::span<const int16_t> GetTangents() const { return tangents; }
+    [[nodiscard]] std::span<const uint16_t> GetTexCoords() const { return texcoords; }
+    [[nodiscard]] std::span<const uint16_t> GetTexCoords2() const { return texcoords2; }
+    [[nodiscard]] std::span<const unsigned char> GetColors() const { return colors; }
+    [[nodiscard]] std::span<const uint16_t> GetIndices() const { return indices; }
+
+    /**
+     * Position from 3 x 16-bit values normalized to the bounding box
+     */
+    static ::Vector3 DecodePosition(const uint16_t* packed, const ::BoundingBox& bounds) {
+        constexpr float scale = 1.0f / 65535.0f;
+        return {
+            bounds.min.x + static_cast<float>(packed[0]) * scale * (bounds.max.x - bounds.min.x),
+            bounds.min.y + static_cast<float>(packed[1]) * scale * (bounds.max.y - bounds.min.y),
+            bounds.min.z + static_cast<float>(packed[2]) * scale * (bounds.max.z - bounds.min.z)};
+    }
+
+    /**
+     * Map a direction onto an octahedron unfolded into a square, as 2 x 16-bit signed normalized values
+     */
+    static void EncodeOctahedral(::Vector3 direction, int16_t* packed) {
+        const float sum = std::fabs(direction.x) + std::fabs(direction.y) + std::fabs(direction.z);
+        float x = sum > 0.0f ? direction.x / sum : 0.0f;
+        float y = sum > 0.0f ? direction.y / sum : 0.0f;
+        if (direction.z < 0.0f) {
+            // Fold the lower half over the diagonals
+            const float foldedX = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+            y = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+            x = foldedX;
+        }
+        packed[0] = static_cast<int16_t>(std::lround(std::clamp(x, -1.0f, 1.0f) * 32767.0f));
+        packed[1] = static_cast<int16_t>(std::lround(std::clamp(y, -1.0f, 1.0f) * 32767.0f));
+    }
+
+    /**
+     * Unit direction from 2 x 16-bit octahedral values
+     */
+    static ::Vector3 DecodeOctahedral(const int16_t* packed) {
+        float x = std::max(static_cast<float>(packed[0]) / 32767.0f, -1.0f);
+        float y = std::max(static_cast<float>(packed[1]) / 32767.0f, -1.0f);
+        const float z = 1.0f - std::fabs(x) - std::fabs(y);
+        if (z < 0.0f) {
+            const float unfoldedX = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+            y = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+            x = unfoldedX;
+        }
+        const float length = std::sqrt(x * x + y * y + z * z);
+        return {x / length, y / length, z / length};
+    }
+
+    /**
+     * IEEE 754 half precision, rounded to nearest even
+     */
+    static uint16_t FloatToHalf(float value) {
+        uint32_t bits = 0;
+        memcpy(&bits, &value, sizeof(bits));
+        const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+        const uint32_t exponent = (bits >> 23) & 0xFFu;
+        uint32_t mantissa = bits & 0x7FFFFFu;
+        if (exponent == 0xFFu) {
+            // Infinity, or a quiet NaN
+            return static_cast<uint16_t>(sign | 0x7C00u | (mantissa != 0 ? 0x200u : 0u));
+        }
+
+        const int halfExponent = static_cast<int>(exponent) - 127 + 15;
+        if (halfExponent >= 31) {
+            return static_cast<uint16_t>(sign | 0x7C00u);
+        }
+        uint32_t shift = 13;
+        uint32_t half = 0;
+        if (halfExponent <= 0) {
+            // Subnormal, the implicit leading bit becomes explicit
+            if (halfExponent < -10) {
+                return sign;
+            }
+            mantissa |= 0x800000u;
+            shift = static_cast<uint32_t>(14 - halfExponent);
+            half = mantissa >> shift;
+        } else {
+            half = (static_cast<uint32_t>(halfExponent) << 10) | (mantissa >> shift);
+        }
+
+        // A carry out of the mantissa correctly moves to the next exponent, or to infinity
+        const uint32_t remainder = mantissa & ((1u << shift) - 1);
+        const uint32_t halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (half & 1u) != 0)) {
+            half++;
+        }
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    static float HalfToFloat(uint16_t half) {
+        const uint32_t sign = (half & 0x8000u) << 16;
+        const uint32_t exponent = (half >> 10) & 0x1Fu;
+        const uint32_t mantissa = half & 0x3FFu;
+        if (exponent == 0) {
+            const float value = std::ldexp(static_cast<float>(mantissa), -24);
+            return sign != 0 ? -value : value;
+        }
+
+        const uint32_t bits = exponent == 0x1Fu ? sign | 0x7F800000u | (mantissa << 13)
+                                                : sign | ((exponent + 112) << 23) | (mantissa << 13);
+        float value = 0.0f;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+protected:
+    static void PackHalf(const float* values, size_t count, std::vector<uint16_t>& packed) {
+        if (values == nullptr) {
+            return;
+        }
+        packed.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            packed[i] = FloatToHalf(values[i]);
+        }
+    }
+
+    static float* UnpackHalf(const std::vector<uint16_t>& packed) {
+        if (packed.empty()) {
+            return nullptr;
+        }
+        auto* values = static_cast<float*>(RL_MALLOC(packed.size() * sizeof(float)));
+        for (size_t i = 0; i < packed.size(); i++) {
+            values[i] = HalfToFloat(packed[i]);
+        }
+        return values;
+    }
+
+    template<typename T>
+    static T* UnpackCopy(const std::vector<T>& packed) {
+        if (packed.empty()) {
+            return nullptr;
+        }
+        auto* values = static_cast<T*>(RL_MALLOC(packed.size() * sizeof(T)));
+        memcpy(values, packed.data(), packed.size() * sizeof(T));
+        return values;
+    }
+
+    int vertexCount{0};
+    int triangleCount{0};
+    ::BoundingBox bounds{};
+    std::vector<uint16_t> positions{};
+    std::vector<int16_t> normals{};
+    std::vector<int16_t> tangents{};
+    std::vector<uint16_t> texcoords{};
+    std::vector<uint16_t> texcoords2{};
+    std::vector<unsigned char> colors{};
+    std::vector<uint16_t> indices{};
+};
+} // namespace raylib
+
+using RPackedMesh = raylib::PackedMesh;
+
+#endif // RAYLIB_CPP_INCLUDE_PACKEDMESH_HPP_
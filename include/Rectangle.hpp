@@ -1,6 +1,8 @@
 #ifndef RAYLIB_CPP_INCLUDE_RECTANGLE_HPP_
 #define RAYLIB_CPP_INCLUDE_RECTANGLE_HPP_
 
+#include "./RayCollision.hpp"
+#include "./SweptCollision.hpp"
 #include "./Vector2.hpp"
 #include "./Vector4.hpp"
 #include "./RadiansDegrees.hpp"
@@ -121,6 +123,15 @@ public:
         return ::CheckCollisionCircleRec(center, radius, *this);
     }
 
+    /**
+     * Get when moving the rectangle by motion first touches another, as a fraction of the motion in the distance.
+     *
+     * @see raylib::SweptCollision
+     */
+    [[nodiscard]] RayCollision GetSweptCollision(::Vector2 motion, const ::Rectangle& obstacle) const {
+        return SweptCollision::Sweep(*this, motion, obstacle);
+    }
+
     [[nodiscard]] Vector2 GetSize() const { return {width, height}; }
 
     Rectangle& SetSize(float newWidth, float newHeight) {
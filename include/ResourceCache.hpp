@@ -0,0 +1,279 @@
+#ifndef RAYLIB_CPP_INCLUDE_RESOURCECACHE_HPP_
+#define RAYLIB_CPP_INCLUDE_RESOURCECACHE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "./MappedFile.hpp"
+#include "./ModelBinary.hpp"
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Shares loaded resources by file name, so every screen asking for the same icon gets the same Texture.
+ *
+ * Resources are loaded once with their file name constructor and handed out as shared handles. Once the memory of
+ * the cached resources exceeds the budget, the least recently requested ones that nobody holds a handle to are
+ * unloaded. Resources still in use are never unloaded, so the budget may be exceeded while they are held.
+ *
+ * @code
+ * raylib::ResourceCache<raylib::Texture> textures(64 * 1024 * 1024);
+ * std::shared_ptr<raylib::Texture> icon = textures.Get("icons/save.png");
+ * @endcode
+ */
+template<typename Resource>
+class ResourceCache {
+public:
+    using Handle = std::shared_ptr<Resource>;
+
+    /**
+     * @param memoryBudget Bytes of resources kept when unused, as estimated by GetResourceSize().
+     * @param shareByContent Share files with the same contents under different names, which reads each new name
+     * once to hash it.
+     */
+    explicit ResourceCache(size_t memoryBudget = std::numeric_limits<size_t>::max(), bool shareByContent = false)
+        : memoryBudget(memoryBudget),
+          shareByContent(shareByContent) {}
+
+    ResourceCache(const ResourceCache&) = delete;
+    ResourceCache& operator=(const ResourceCache&) = delete;
+
+    ResourceCache(ResourceCache&&) noexcept = default;
+    ResourceCache& operator=(ResourceCache&&) noexcept = default;
+
+    /**
+     * The shared resource for the file, loaded on first request.
+     *
+     * @throws raylib::RaylibException Throws if the resource failed to load.
+     */
+    Handle Get(const std::string_view fileName) {
+        std::string path(fileName);
+        if (const auto alias = aliases.find(path); alias != aliases.end()) {
+            path = alias->second;
+        }
+
+        if (const auto known = paths.find(path); known != paths.end()) {
+            hitCount++;
+            return Touch(known->second);
+        }
+
+        uint64_t hash = 0;
+        if (shareByContent) {
+            const MappedFile file(path);
+            hash = ModelBinary::Hash(file.GetSpan());
+            if (const auto same = hashes.find(hash); same != hashes.end()) {
+                hitCount++;
+                paths.emplace(path, same->second);
+                entries[same->second].paths.push_back(path);
+                return Touch(same->second);
+            }
+        }
+
+        missCount++;
+        Handle resource = std::make_shared<Resource>(std::string_view(path));
+        const uint64_t id = nextId++;
+        Entry& entry = entries[id];
+        entry.resource = resource;
+        entry.size = GetResourceSize(*resource);
+        entry.hash = hash;
+        entry.paths.push_back(path);
+        order.push_front(id);
+        entry.position = order.begin();
+        paths.emplace(std::move(path), id);
+        if (shareByContent) {
+            hashes.emplace(hash, id);
+        }
+        memoryUsage += entry.size;
+        Trim();
+        return resource;
+    }
+
+    /**
+     * Whether the file is loaded, without counting a request.
+     */
+    [[nodiscard]] bool Contains(const std::string_view fileName) const {
+        std::string path(fileName);
+        if (const auto alias = aliases.find(path); alias != aliases.end()) {
+            path = alias->second;
+        }
+        return paths.find(path) != paths.end();
+    }
+
+    /**
+     * Make requests for the alias, i.e. a logical name like "ui/save", return the resource of the file.
+     */
+    ResourceCache& Alias(const std::string_view alias, const std::string_view fileName) {
+        aliases[std::string(alias)] = std::string(fileName);
+        return *this;
+    }
+
+    /**
+     * Unload the least recently requested unused resources until the cache fits in the memory budget.
+     */
+    void Trim() {
+        for (auto id = order.end(); memoryUsage > memoryBudget && id != order.begin();) {
+            --id;
+            Entry& entry = entries[*id];
+            if (entry.resource.use_count() > 1) {
+                continue;
+            }
+            memoryUsage -= entry.size;
+            for (const std::string& path : entry.paths) {
+                paths.erase(path);
+            }
+            if (shareByContent) {
+                hashes.erase(entry.hash);
+            }
+            evictionCount++;
+            entries.erase(*id);
+            id = order.erase(id);
+        }
+    }
+
+    /**
+     * Drop every resource from the cache, they unload once the last handle is released.
+     */
+    void Clear() {
+        entries.clear();
+        order.clear();
+        paths.clear();
+        hashes.clear();
+        memoryUsage = 0;
+    }
+
+    [[nodiscard]] size_t GetMemoryBudget() const { return memoryBudget; }
+
+    /**
+     * Change the budget, unloading unused resources right away if it shrinks below the memory in use.
+     */
+    void SetMemoryBudget(size_t budget) {
+        memoryBudget = budget;
+        Trim();
+    }
+
+    /** Estimated bytes of all cached resources, including those in use */
+    [[nodiscard]] size_t GetMemoryUsage() const { return memoryUsage; }
+
+    [[nodiscard]] size_t GetCount() const { return entries.size(); }
+
+    /** Requests served from the cache since the last ResetStatistics() */
+    [[nodiscard]] size_t GetHitCount() const { return hitCount; }
+
+    /** Requests that loaded a resource since the last ResetStatistics() */
+    [[nodiscard]] size_t GetMissCount() const { return missCount; }
+
+    /** Resources unloaded to fit the budget since the last ResetStatistics() */
+    [[nodiscard]] size_t GetEvictionCount() const { return evictionCount; }
+
+    void ResetStatistics() {
+        hitCount = 0;
+        missCount = 0;
+        evictionCount = 0;
+    }
+
+    /**
+     * Bytes of pixel data of a texture and its mipmaps.
+     */
+    static size_t GetResourceSize(const ::Texture& texture) {
+        size_t size = 0;
+        for (int level = 0, width = texture.width, height = texture.height; level < texture.mipmaps; level++) {
+            size += static_cast<size_t>(std::max(::GetPixelDataSize(width, height, texture.format), 0));
+            width = width > 1 ? width / 2 : 1;
+            height = height > 1 ? height / 2 : 1;
+        }
+        return size;
+    }
+
+    static size_t GetResourceSize(const ::Image& image) {
+        return GetResourceSize(::Texture{0, image.width, image.height, image.mipmaps, image.format});
+    }
+
+    /**
+     * Bytes of the atlas texture and the glyph images of a font.
+     */
+    static size_t GetResourceSize(const ::Font& font) {
+        size_t size = GetResourceSize(font.texture);
+        for (int i = 0; font.glyphs != nullptr && i < font.glyphCount; i++) {
+            size += sizeof(::GlyphInfo) + sizeof(::Rectangle) + GetResourceSize(font.glyphs[i].image);
+        }
+        return size;
+    }
+
+    /**
+     * Bytes of the vertex data of a model's meshes, textures of the materials are not counted.
+     */
+    static size_t GetResourceSize(const ::Model& model) {
+        size_t size = 0;
+        for (int i = 0; model.meshes != nullptr && i < model.meshCount; i++) {
+            const ::Mesh& mesh = model.meshes[i];
+            const size_t floatBytes = static_cast<size_t>(std::max(mesh.vertexCount, 0)) * sizeof(float);
+            size += mesh.vertices != nullptr ? 3 * floatBytes : 0;
+            size += mesh.texcoords != nullptr ? 2 * floatBytes : 0;
+            size += mesh.texcoords2 != nullptr ? 2 * floatBytes : 0;
+            size += mesh.normals != nullptr ? 3 * floatBytes : 0;
+            size += mesh.tangents != nullptr ? 4 * floatBytes : 0;
+            size += mesh.colors != nullptr ? floatBytes : 0;
+            size += mesh.boneIds != nullptr ? floatBytes : 0;
+            size += mesh.boneWeights != nullptr ? 4 * floatBytes : 0;
+            size += mesh.animVertices != nullptr ? 3 * floatBytes : 0;
+            size += mesh.animNormals != nullptr ? 3 * floatBytes : 0;
+            size += mesh.indices != nullptr
+                        ? static_cast<size_t>(std::max(mesh.triangleCount, 0)) * 3 * sizeof(unsigned short)
+                        : 0;
+        }
+        return size;
+    }
+
+    static size_t GetResourceSize(const ::Wave& wave) {
+        return static_cast<size_t>(wave.frameCount) * wave.channels * wave.sampleSize / 8;
+    }
+
+    static size_t GetResourceSize(const ::Sound& sound) {
+        return static_cast<size_t>(sound.frameCount) * sound.stream.channels * sound.stream.sampleSize / 8;
+    }
+protected:
+    struct Entry {
+        Handle resource{};
+        size_t size{0};
+        uint64_t hash{0};
+        std::vector<std::string> paths{};
+        std::list<uint64_t>::iterator position{};
+    };
+
+    Handle Touch(uint64_t id) {
+        Entry& entry = entries[id];
+        order.splice(order.begin(), order, entry.position);
+        return entry.resource;
+    }
+
+    size_t memoryBudget{std::numeric_limits<size_t>::max()};
+    bool shareByContent{false};
+    uint64_t nextId{0};
+    std::unordered_map<uint64_t, Entry> entries{};
+    /** Entry ids, most recently requested first */
+    std::list<uint64_t> order{};
+    std::unordered_map<std::string, uint64_t> paths{};
+    std::unordered_map<uint64_t, uint64_t> hashes{};
+    std::unordered_map<std::string, std::string> aliases{};
+    size_t memoryUsage{0};
+    size_t hitCount{0};
+    size_t missCount{0};
+    size_t evictionCount{0};
+};
+} // namespace raylib
+
+template<typename Resource>
+using RResourceCache = raylib::ResourceCache<Resource>;
+
+#endif // RAYLIB_CPP_INCLUDE_RESOURCECACHE_HPP_
@@ -0,0 +1,401 @@
+#ifndef RAYLIB_CPP_INCLUDE_SCENEGRAPH_HPP_
+#define RAYLIB_CPP_INCLUDE_SCENEGRAPH_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "./RaylibException.hpp"
+#include "./ThreadPool.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+#include "./raymath.hpp"
+
+namespace raylib {
+/**
+ * Hierarchy of transforms stored as flat arrays sorted by depth, so every parent precedes its children.
+ *
+ * Nodes are referred to by handles that stay valid while the arrays are reordered. Update() recomputes the world
+ * matrices of the nodes whose local transform changed and of their descendants only, one depth level after the
+ * other, with the nodes of a level spread over a ThreadPool.
+ *
+ * @code
+ * raylib::SceneGraph scene;
+ * raylib::SceneGraph::Node car = scene.Create({}, MatrixTranslate(0, 0, 10), &carModel);
+ * raylib::SceneGraph::Node wheel = scene.Create(car, MatrixTranslate(1, 0, 1), &wheelModel);
+ * ...
+ * scene.SetLocalTransform(car, MatrixTranslate(0, 0, 11));
+ * scene.Update();
+ * scene.Draw();
+ * @endcode
+ */
+class SceneGraph {
+public:
+    /**
+     * Handle of a node, the default one stands for no node, i.e. no parent.
+     */
+    struct Node {
+        constexpr Node() : index(UINT32_MAX), generation(0) {}
+        constexpr Node(uint32_t index, uint32_t generation) : index(index), generation(generation) {}
+
+        uint32_t index;
+        uint32_t generation;
+
+        bool operator==(const Node& other) const { return index == other.index && generation == other.generation; }
+    };
+
+    explicit SceneGraph(ThreadPool& pool = ThreadPool::GetDefault()) : pool(&pool) {}
+
+    SceneGraph(const SceneGraph&) = default;
+    SceneGraph& operator=(const SceneGraph&) = default;
+    SceneGraph(SceneGraph&& other) = default;
+    SceneGraph& operator=(SceneGraph&& other) = default;
+
+    /**
+     * Add a node, drawn with the model unless the model is null. The model must outlive the node.
+     *
+     * @throws raylib::RaylibException Throws if the parent is not a node of this graph.
+     */
+    Node Create(Node parent = {}, const ::Matrix& localTransform = ::MatrixIdentity(), const ::Model* model = nullptr) {
+        const int32_t parentPosition = parent == Node{} ? -1 : static_cast<int32_t>(GetPosition(parent));
+
+        Node node;
+        if (freeHandles.empty()) {
+            node.index = static_cast<uint32_t>(handles.size());
+            handles.push_back({0, 0});
+        } else {
+            node.index = freeHandles.back();
+            freeHandles.pop_back();
+        }
+        Handle& handle = handles[node.index];
+        handle.position = static_cast<uint32_t>(locals.size());
+        node.generation = handle.generation;
+
+        // Appending keeps the depth order unless the node is shallower than the last one
+        const uint32_t depth = parentPosition < 0 ? 0 : depths[static_cast<size_t>(parentPosition)] + 1;
+        if (!orderChanged) {
+            if (levels.empty()) {
+                levels.push_back(0);
+            }
+            if (depth + size_t{1} == levels.size()) {
+                levels.push_back(levels.back());
+            }
+            if (depth + size_t{2} == levels.size()) {
+                levels.back()++;
+            } else {
+                orderChanged = true;
+            }
+        }
+        locals.push_back(localTransform);
+        worlds.push_back(localTransform);
+        parents.push_back(parentPosition);
+        depths.push_back(depth);
+        flags.push_back(Dirty | Visible);
+        models.push_back(model);
+        nodeHandles.push_back(node.index);
+        dirty = true;
+        return node;
+    }
+
+    /**
+     * Remove a node and its descendants on the next Update(), which invalidates their handles.
+     */
+    void Remove(Node node) {
+        flags[GetPosition(node)] |= Removed;
+        removals = true;
+    }
+
+    [[nodiscard]] bool IsValid(Node node) const {
+        return node.index < handles.size() && handles[node.index].generation == node.generation &&
+               handles[node.index].position < locals.size();
+    }
+
+    /**
+     * Move a node and its descendants under another parent, or to the top with the default Node.
+     *
+     * @throws raylib::RaylibException Throws if the parent is the node itself or one of its descendants.
+     */
+    void SetParent(Node node, Node parent) {
+        const size_t position = GetPosition(node);
+        int32_t parentPosition = parent == Node{} ? -1 : static_cast<int32_t>(GetPosition(parent));
+        for (int32_t ancestor = parentPosition; ancestor >= 0; ancestor = parents[static_cast<size_t>(ancestor)]) {
+            if (static_cast<size_t>(ancestor) == position) {
+                throw RaylibException("SceneGraph node can not become its own descendant");
+            }
+        }
+        parents[position] = parentPosition;
+        flags[position] |= Dirty;
+        orderChanged = true;
+        dirty = true;
+    }
+
+    [[nodiscard]] Node GetParent(Node node) const {
+        const int32_t parent = parents[GetPosition(node)];
+        if (parent < 0) {
+            return {};
+        }
+        const uint32_t index = nodeHandles[static_cast<size_t>(parent)];
+        return {index, handles[index].generation};
+    }
+
+    void SetLocalTransform(Node node, const ::Matrix& transform) {
+        const size_t position = GetPosition(node);
+        locals[position] = transform;
+        flags[position] |= Dirty;
+        dirty = true;
+    }
+
+    /**
+     * Set the local transform from a scale, then a rotation, then a translation.
+     */
+    void SetLocalTransform(Node node, ::Vector3 translation, ::Quaternion rotation, ::Vector3 scale = {1, 1, 1}) {
+        SetLocalTransform(
+            node,
+            ::MatrixMultiply(
+                ::MatrixMultiply(::MatrixScale(scale.x, scale.y, scale.z), ::QuaternionToMatrix(rotation)),
+                ::MatrixTranslate(translation.x, translation.y, translation.z)));
+    }
+
+    [[nodiscard]] const ::Matrix& GetLocalTransform(Node node) const { return locals[GetPosition(node)]; }
+
+    /**
+     * World transform as of the last Update()
+     */
+    [[nodiscard]] const ::Matrix& GetWorldTransform(Node node) const { return worlds[GetPosition(node)]; }
+
+    void SetModel(Node node, const ::Model* model) { models[GetPosition(node)] = model; }
+
+    [[nodiscard]] const ::Model* GetModel(Node node) const { return models[GetPosition(node)]; }
+
+    /**
+     * Hide or show a node when drawing, its descendants are not affected.
+     */
+    void SetVisible(Node node, bool visible) {
+        uint8_t& nodeFlags = flags[GetPosition(node)];
+        nodeFlags = static_cast<uint8_t>(visible ? (nodeFlags | Visible) : (nodeFlags & ~Visible));
+    }
+
+    [[nodiscard]] bool IsVisible(Node node) const { return (flags[GetPosition(node)] & Visible) != 0; }
+
+    /**
+     * Whether the last Update() changed the world transform of the node.
+     */
+    [[nodiscard]] bool HasChanged(Node node) const { return (flags[GetPosition(node)] & Changed) != 0; }
+
+    /**
+     * Apply pending removals and reparenting, then recompute the world transforms of changed subtrees.
+     */
+    void Update() {
+        updatedCount = 0;
+        if (changes) {
+            for (uint8_t& nodeFlags : flags) {
+                nodeFlags = static_cast<uint8_t>(nodeFlags & ~Changed);
+            }
+            changes = false;
+        }
+        if (removals || orderChanged) {
+            Reorder();
+        }
+        if (!dirty) {
+            return;
+        }
+
+        std::atomic<size_t> updated{0};
+        for (size_t level = 0; level + 1 < levels.size(); level++) {
+            const size_t first = levels[level];
+            pool->ParallelFor(levels[level + 1] - first, nodesPerTask, [&, first](size_t begin, size_t end) {
+                size_t count = 0;
+                for (size_t i = first + begin; i < first + end; i++) {
+                    const int32_t parent = parents[i];
+                    const bool parentChanged = parent >= 0 && (flags[static_cast<size_t>(parent)] & Changed) != 0;
+                    if ((flags[i] & Dirty) == 0 && !parentChanged) {
+                        continue;
+                    }
+                    worlds[i] =
+                        parent < 0 ? locals[i] : ::MatrixMultiply(locals[i], worlds[static_cast<size_t>(parent)]);
+                    flags[i] = static_cast<uint8_t>((flags[i] & ~Dirty) | Changed);
+                    count++;
+                }
+                updated += count;
+            });
+        }
+        updatedCount = updated;
+        changes = updatedCount > 0;
+        dirty = false;
+    }
+
+    /**
+     * Draw every visible node that has a model, transformed by the node's world transform.
+     */
+    void Draw(::Color tint = {255, 255, 255, 255}) const {
+        for (size_t i = 0; i < locals.size(); i++) {
+            if (models[i] == nullptr || (flags[i] & Visible) == 0) {
+                continue;
+            }
+            ::Model model = *models[i];
+            model.transform = ::MatrixMultiply(model.transform, worlds[i]);
+            ::DrawModel(model, {0, 0, 0}, 1.0f, tint);
+        }
+    }
+
+    /**
+     * Append the instance transforms of every visible node drawn with the model, for DrawMeshInstanced() or an
+     * InstanceCuller.
+     */
+    void GatherInstances(const ::Model* model, std::vector<::Matrix>& transforms) const {
+        for (size_t i = 0; i < locals.size(); i++) {
+            if (models[i] == model && (flags[i] & Visible) != 0) {
+                transforms.push_back(::MatrixMultiply(model->transform, worlds[i]));
+            }
+        }
+    }
+
+    /**
+     * World transforms of all nodes, parents first, as of the last Update().
+     */
+    [[nodiscard]] std::span<const ::Matrix> GetWorldTransforms() const { return worlds; }
+
+    [[nodiscard]] size_t GetNodeCount() const { return locals.size(); }
+
+    /** World transforms recomputed by the last Update() */
+    [[nodiscard]] size_t GetUpdatedCount() const { return updatedCount; }
+
+    /** Depth levels of the hierarchy, as of the last Update() */
+    [[nodiscard]] size_t GetLevelCount() const { return levels.size() > 0 ? levels.size() - 1 : 0; }
+protected:
+    enum Flag : uint8_t { Dirty = 1, Visible = 2, Removed = 4, Changed = 8 };
+
+    struct Handle {
+        uint32_t position{0};
+        uint32_t generation{0};
+    };
+
+    static constexpr size_t nodesPerTask = 2048;
+
+    size_t GetPosition(Node node) const {
+        if (!IsValid(node)) {
+            throw RaylibException("SceneGraph node is not valid");
+        }
+        return handles[node.index].position;
+    }
+
+    /**
+     * Drop removed subtrees and sort the nodes by depth again, keeping their order within a level.
+     */
+    void Reorder() {
+        const size_t count = locals.size();
+
+        // Depths and removals follow the parents, which may come after their children after SetParent()
+        std::vector<uint32_t> newDepths(count, UINT32_MAX);
+        std::vector<size_t> chain;
+        for (size_t i = 0; i < count; i++) {
+            for (size_t node = i; newDepths[node] == UINT32_MAX;) {
+                chain.push_back(node);
+                if (parents[node] < 0) {
+                    break;
+                }
+                node = static_cast<size_t>(parents[node]);
+            }
+            for (auto node = chain.rbegin(); node != chain.rend(); ++node) {
+                const int32_t parent = parents[*node];
+                if (parent >= 0) {
+                    const auto p = static_cast<size_t>(parent);
+                    newDepths[*node] = newDepths[p] + 1;
+                    flags[*node] = static_cast<uint8_t>(flags[*node] | (flags[p] & Removed));
+                } else {
+                    newDepths[*node] = 0;
+                }
+            }
+            chain.clear();
+        }
+
+        // Counting sort by depth
+        std::vector<size_t> starts;
+        for (size_t i = 0; i < count; i++) {
+            if ((flags[i] & Removed) != 0) {
+                continue;
+            }
+            if (starts.size() <= newDepths[i] + size_t{1}) {
+                starts.resize(newDepths[i] + size_t{2}, 0);
+            }
+            starts[newDepths[i] + size_t{1}]++;
+        }
+        for (size_t level = 1; level < starts.size(); level++) {
+            starts[level] += starts[level - 1];
+        }
+        levels = starts;
+
+        std::vector<uint32_t> positions(count, UINT32_MAX);
+        for (size_t i = 0; i < count; i++) {
+            if ((flags[i] & Removed) == 0) {
+                positions[i] = static_cast<uint32_t>(starts[newDepths[i]]++);
+            }
+        }
+
+        const size_t kept = levels.empty() ? 0 : levels.back();
+        std::vector<::Matrix> newLocals(kept);
+        std::vector<::Matrix> newWorlds(kept);
+        std::vector<int32_t> newParents(kept);
+        std::vector<uint32_t> sortedDepths(kept);
+        std::vector<uint8_t> newFlags(kept);
+        std::vector<const ::Model*> newModels(kept);
+        std::vector<uint32_t> newHandles(kept);
+        for (size_t i = 0; i < count; i++) {
+            Handle& handle = handles[nodeHandles[i]];
+            if (positions[i] == UINT32_MAX) {
+                handle.generation++;
+                handle.position = UINT32_MAX;
+                freeHandles.push_back(nodeHandles[i]);
+                continue;
+            }
+            const size_t target = positions[i];
+            newLocals[target] = locals[i];
+            newWorlds[target] = worlds[i];
+            const int32_t parent = parents[i];
+            newParents[target] = parent < 0 ? -1 : static_cast<int32_t>(positions[static_cast<size_t>(parent)]);
+            sortedDepths[target] = newDepths[i];
+            newFlags[target] = flags[i];
+            newModels[target] = models[i];
+            newHandles[target] = nodeHandles[i];
+            handle.position = static_cast<uint32_t>(target);
+        }
+
+        locals = std::move(newLocals);
+        worlds = std::move(newWorlds);
+        parents = std::move(newParents);
+        depths = std::move(sortedDepths);
+        flags = std::move(newFlags);
+        models = std::move(newModels);
+        nodeHandles = std::move(newHandles);
+        removals = false;
+        orderChanged = false;
+    }
+
+    ThreadPool* pool{nullptr};
+
+    // Per node, sorted by depth
+    std::vector<::Matrix> locals{};
+    std::vector<::Matrix> worlds{};
+    std::vector<int32_t> parents{};
+    std::vector<uint32_t> depths{};
+    std::vector<uint8_t> flags{};
+    std::vector<const ::Model*> models{};
+    std::vector<uint32_t> nodeHandles{};
+
+    /** First node of each depth level, followed by the node count */
+    std::vector<size_t> levels{};
+    std::vector<Handle> handles{};
+    std::vector<uint32_t> freeHandles{};
+    bool dirty{false};
+    bool changes{false};
+    bool removals{false};
+    bool orderChanged{false};
+    size_t updatedCount{0};
+};
+} // namespace raylib
+
+using RSceneGraph = raylib::SceneGraph;
+
+#endif // RAYLIB_CPP_INCLUDE_SCENEGRAPH_HPP_
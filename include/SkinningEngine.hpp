@@ -0,0 +1,585 @@
+#ifndef RAYLIB_CPP_INCLUDE_SKINNINGENGINE_HPP_
+#define RAYLIB_CPP_INCLUDE_SKINNINGENGINE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "./RaylibException.hpp"
+#include "./ThreadPool.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+#ifdef RAYLIB_CPP_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace raylib {
+/**
+ * CPU skinning for animated models, a parallel replacement for ::UpdateModelAnimation().
+ *
+ * Vertex ranges of all meshes are blended on a ThreadPool, with the bone and normal matrices computed once per bone
+ * rather than per vertex. Meshes whose bones kept their pose since the last update are skipped. The engine keeps
+ * per model state keyed on the meshes array, so call Forget() before unloading a model it has seen.
+ *
+ * @code
+ * raylib::SkinningEngine skinning;
+ * std::vector<raylib::SkinningEngine::Instance> instances;
+ * for (Npc& npc : npcs) {
+ *     instances.push_back({&npc.model, &animations[npc.clip], npc.frame});
+ * }
+ * skinning.Update(instances);
+ * @endcode
+ */
+class SkinningEngine {
+public:
+    /**
+     * Model to skin, posed by an animation frame, or by bone matrices relative to the bind pose when pose is set.
+     */
+    struct Instance {
+        ::Model* model{nullptr};
+        const ::ModelAnimation* animation{nullptr};
+        int frame{0};
+        std::span<const ::Matrix> pose{};
+    };
+
+    explicit SkinningEngine(ThreadPool& pool = ThreadPool::GetDefault()) : pool(&pool) {}
+
+    SkinningEngine(const SkinningEngine&) = default;
+    SkinningEngine& operator=(const SkinningEngine&) = default;
+    SkinningEngine(SkinningEngine&& other) = default;
+    SkinningEngine& operator=(SkinningEngine&& other) = default;
+
+    /**
+     * Skin the model to a frame of the animation.
+     *
+     * @param upload Update the position and normal buffers of the meshes on the GPU, needs the main thread.
+     */
+    SkinningEngine& Update(::Model& model, const ::ModelAnimation& animation, int frame, bool upload = true) {
+        const Instance instance{&model, &animation, frame, {}};
+        return Update(std::span<const Instance>(&instance, 1), upload);
+    }
+
+    /**
+     * Skin the model with bone matrices relative to the bind pose, as in ::Mesh::boneMatrices.
+     */
+    SkinningEngine& Update(::Model& model, std::span<const ::Matrix> pose, bool upload = true) {
+        const Instance instance{&model, nullptr, 0, pose};
+        return Update(std::span<const Instance>(&instance, 1), upload);
+    }
+
+    /**
+     * Skin several models at once, sharing the worker threads between all of their meshes.
+     *
+     * Each model may appear only once.
+     *
+     * @throws raylib::RaylibException Throws if an animation does not match the skeleton of its model, or if a model
+     * appears more than once.
+     */
+    SkinningEngine& Update(std::span<const Instance> instances, bool upload = true) {
+        skinnedMeshCount = 0;
+        skippedMeshCount = 0;
+        skinnedVertexCount = 0;
+
+        // Creating the states up front leaves the workers with lookups only
+        generation++;
+        std::vector<ModelState*> states(instances.size());
+        for (size_t i = 0; i < instances.size(); i++) {
+            const Instance& instance = instances[i];
+            if (instance.model == nullptr) {
+                throw RaylibException("SkinningEngine instance requires a model");
+            }
+            const size_t boneCount = GetBoneCount(*instance.model, instance.animation, instance.pose);
+            ModelState& state = models[instance.model->meshes];
+            // Two workers would write the same buffers
+            if (state.generation == generation) {
+                throw RaylibException("SkinningEngine instances may not share a model");
+            }
+            state.generation = generation;
+            state.palette.resize(boneCount);
+            state.normalPalette.resize(boneCount);
+            state.meshes.resize(static_cast<size_t>(instance.model->meshCount));
+            states[i] = &state;
+        }
+
+        pool->ParallelFor(instances.size(), instancesPerTask, [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; i++) {
+                UpdatePose(instances[i], *states[i]);
+            }
+        });
+
+        // Vertex ranges of every changed mesh, so one large mesh is split as well as many small ones are spread
+        std::vector<Range> ranges;
+        for (size_t i = 0; i < instances.size(); i++) {
+            const ::Model& model = *instances[i].model;
+            for (size_t m = 0; m < states[i]->meshes.size(); m++) {
+                if (!states[i]->meshes[m].changed) {
+                    skippedMeshCount++;
+                    continue;
+                }
+                const ::Mesh& mesh = model.meshes[m];
+                const auto vertexCount = static_cast<size_t>(mesh.vertexCount);
+                for (size_t first = 0; first < vertexCount; first += verticesPerTask) {
+                    ranges.push_back({&mesh, states[i], first, std::min(first + verticesPerTask, vertexCount)});
+                }
+                skinnedMeshCount++;
+                skinnedVertexCount += vertexCount;
+            }
+        }
+
+        pool->ParallelFor(ranges.size(), 1, [&ranges](size_t first, size_t last) {
+            for (size_t i = first; i < last; i++) {
+                Skin(ranges[i]);
+            }
+        });
+
+        if (upload) {
+            for (size_t i = 0; i < instances.size(); i++) {
+                const ::Model& model = *instances[i].model;
+                for (size_t m = 0; m < states[i]->meshes.size(); m++) {
+                    if (states[i]->meshes[m].changed) {
+                        Upload(model.meshes[m]);
+                    }
+                }
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * Drop the state kept for the model, i.e. before unloading it.
+     */
+    void Forget(const ::Model& model) { models.erase(model.meshes); }
+
+    /**
+     * Drop the state of all models, so the next update skins every mesh.
+     */
+    void Clear() { models.clear(); }
+
+    /** Meshes skinned by the last Update() */
+    [[nodiscard]] size_t GetSkinnedMeshCount() const { return skinnedMeshCount; }
+
+    /** Meshes skipped by the last Update(), as none of their bones moved */
+    [[nodiscard]] size_t GetSkippedMeshCount() const { return skippedMeshCount; }
+
+    /** Vertices skinned by the last Update() */
+    [[nodiscard]] size_t GetSkinnedVertexCount() const { return skinnedVertexCount; }
+
+    /**
+     * Compute the bone matrices of an animation frame relative to the bind pose of the model, as
+     * ::UpdateModelAnimationBones() does.
+     *
+     * @throws raylib::RaylibException Throws if the animation does not match the skeleton of the model.
+     */
+    static void ComputeBoneMatrices(
+        const ::Model& model,
+        const ::ModelAnimation& animation,
+        int frame,
+        std::span<::Matrix> boneMatrices) {
+        const size_t boneCount = GetBoneCount(model, &animation, {});
+        ComputeBoneMatrices(model, std::span<const ::Transform>(GetFramePose(animation, frame), boneCount), boneMatrices);
+    }
+
+    /**
+     * Compute the bone matrices of a model space pose, i.e. sampled from an AnimationClip, relative to the bind
+     * pose of the model.
+     *
+     * @throws raylib::RaylibException Throws if the pose has more bones than the model.
+     */
+    static void ComputeBoneMatrices(
+        const ::Model& model,
+        std::span<const ::Transform> pose,
+        std::span<::Matrix> boneMatrices) {
+        if (pose.size() > static_cast<size_t>(std::max(model.boneCount, 0)) || model.bindPose == nullptr) {
+            throw RaylibException("Pose does not match the skeleton of the Model");
+        }
+        const size_t boneCount = std::min(pose.size(), boneMatrices.size());
+        for (size_t bone = 0; bone < boneCount; bone++) {
+            const Affine inverseBind = Invert(FromTransform(model.bindPose[bone]));
+            boneMatrices[bone] = ToMatrix(Multiply(FromTransform(pose[bone]), inverseBind));
+        }
+    }
+protected:
+    /**
+     * 3x4 matrix stored as the images of the three axes and the translation, i.e. x' = x * axes[0] + y * axes[1] +
+     * z * axes[2] + axes[3], with the fourth lane of each column unused.
+     */
+    struct Affine {
+        alignas(16) float axes[4][4]{};
+    };
+
+    struct MeshState {
+        const float* vertices{nullptr};
+        const unsigned char* boneIds{nullptr};
+        int vertexCount{0};
+        std::vector<unsigned char> bones{};
+        std::vector<Affine> pose{};
+        bool changed{false};
+    };
+
+    struct ModelState {
+        const ::Transform* bindPose{nullptr};
+        std::vector<Affine> inverseBind{};
+        std::vector<Affine> palette{};
+        std::vector<Affine> normalPalette{};
+        std::vector<MeshState> meshes{};
+        /** Update() that last posed the model */
+        size_t generation{0};
+    };
+
+    struct Range {
+        const ::Mesh* mesh{nullptr};
+        const ModelState* state{nullptr};
+        size_t first{0};
+        size_t last{0};
+    };
+
+    /** Models posed by each thread pool task */
+    static constexpr size_t instancesPerTask = 4;
+
+    /** Vertices blended by each thread pool task */
+    static constexpr size_t verticesPerTask = 2048;
+
+    static size_t GetBoneCount(
+        const ::Model& model,
+        const ::ModelAnimation* animation,
+        std::span<const ::Matrix> pose) {
+        if (!pose.empty()) {
+            return pose.size();
+        }
+        if (animation == nullptr) {
+            throw RaylibException("SkinningEngine instance requires an animation or a pose");
+        }
+        if (animation->boneCount != model.boneCount || model.bindPose == nullptr || animation->framePoses == nullptr ||
+            animation->frameCount <= 0) {
+            throw RaylibException("ModelAnimation does not match the skeleton of the Model");
+        }
+        return static_cast<size_t>(model.boneCount);
+    }
+
+    static const ::Transform* GetFramePose(const ::ModelAnimation& animation, int frame) {
+        frame %= animation.frameCount;
+        return animation.framePoses[frame < 0 ? frame + animation.frameCount : frame];
+    }
+
+    /**
+     * Fill the palettes of the model, and flag the meshes that use a bone whose matrix changed.
+     */
+    static void UpdatePose(const Instance& instance, ModelState& state) {
+        const ::Model& model = *instance.model;
+        const size_t boneCount = state.palette.size();
+        if (!instance.pose.empty()) {
+            for (size_t bone = 0; bone < boneCount; bone++) {
+                state.palette[bone] = FromMatrix(instance.pose[bone]);
+            }
+        } else {
+            if (state.bindPose != model.bindPose || state.inverseBind.size() != boneCount) {
+                state.inverseBind.resize(boneCount);
+                for (size_t bone = 0; bone < boneCount; bone++) {
+                    state.inverseBind[bone] = Invert(FromTransform(model.bindPose[bone]));
+                }
+                state.bindPose = model.bindPose;
+            }
+
+            const ::Transform* pose = GetFramePose(*instance.animation, instance.frame);
+            for (size_t bone = 0; bone < boneCount; bone++) {
+                state.palette[bone] = Multiply(FromTransform(pose[bone]), state.inverseBind[bone]);
+            }
+        }
+        for (size_t bone = 0; bone < boneCount; bone++) {
+            state.normalPalette[bone] = NormalMatrix(state.palette[bone]);
+        }
+
+        for (size_t m = 0; m < state.meshes.size(); m++) {
+            ::Mesh& mesh = model.meshes[m];
+            MeshState& meshState = state.meshes[m];
+            meshState.changed = false;
+            if (mesh.vertices == nullptr || mesh.animVertices == nullptr || mesh.boneIds == nullptr ||
+                mesh.boneWeights == nullptr) {
+                continue;
+            }
+
+            if (meshState.vertices != mesh.vertices || meshState.boneIds != mesh.boneIds ||
+                meshState.vertexCount != mesh.vertexCount) {
+                FindBones(mesh, meshState);
+            }
+            for (size_t i = 0; i < meshState.bones.size(); i++) {
+                const size_t bone = meshState.bones[i];
+                if (bone >= boneCount) {
+                    continue;
+                }
+                const Affine& matrix = state.palette[bone];
+                if (memcmp(&meshState.pose[i], &matrix, sizeof(Affine)) != 0) {
+                    meshState.pose[i] = matrix;
+                    meshState.changed = true;
+                }
+            }
+
+            // Keep the matrices for GPU skinning in sync, as ::UpdateModelAnimationBones() would
+            if (meshState.changed && mesh.boneMatrices != nullptr) {
+                const size_t count = std::min(boneCount, static_cast<size_t>(std::max(mesh.boneCount, 0)));
+                for (size_t bone = 0; bone < count; bone++) {
+                    mesh.boneMatrices[bone] = ToMatrix(state.palette[bone]);
+                }
+            }
+        }
+    }
+
+    /**
+     * Collect the bones the mesh is weighted to, and force a skin on the next update.
+     */
+    static void FindBones(const ::Mesh& mesh, MeshState& meshState) {
+        bool used[256]{};
+        const size_t influenceCount = static_cast<size_t>(mesh.vertexCount) * 4;
+        for (size_t i = 0; i < influenceCount; i++) {
+            if (mesh.boneWeights[i] != 0.0f) {
+                used[mesh.boneIds[i]] = true;
+            }
+        }
+
+        meshState.bones.clear();
+        for (size_t bone = 0; bone < 256; bone++) {
+            if (used[bone]) {
+                meshState.bones.push_back(static_cast<unsigned char>(bone));
+            }
+        }
+        meshState.pose.assign(meshState.bones.size(), Affine{});
+        meshState.vertices = mesh.vertices;
+        meshState.boneIds = mesh.boneIds;
+        meshState.vertexCount = mesh.vertexCount;
+        meshState.changed = true;
+    }
+
+    /**
+     * Blend the positions and normals of the range with the up to four bones of each vertex.
+     */
+    static void Skin(const Range& range) {
+        const ::Mesh& mesh = *range.mesh;
+        const Affine* palette = range.state->palette.data();
+        const Affine* normalPalette = range.state->normalPalette.data();
+        const size_t boneCount = range.state->palette.size();
+        const bool skinNormals = mesh.normals != nullptr && mesh.animNormals != nullptr;
+
+        for (size_t v = range.first; v < range.last; v++) {
+            const float* position = mesh.vertices + v * 3;
+            const float* weights = mesh.boneWeights + v * 4;
+            const unsigned char* ids = mesh.boneIds + v * 4;
+#ifdef RAYLIB_CPP_SSE2
+            const __m128 x = _mm_set1_ps(position[0]);
+            const __m128 y = _mm_set1_ps(position[1]);
+            const __m128 z = _mm_set1_ps(position[2]);
+            __m128 result = _mm_setzero_ps();
+            for (size_t k = 0; k < 4; k++) {
+                if (weights[k] == 0.0f || ids[k] >= boneCount) {
+                    continue;
+                }
+                const Affine& bone = palette[ids[k]];
+                __m128 transformed = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(x, _mm_load_ps(bone.axes[0])), _mm_mul_ps(y, _mm_load_ps(bone.axes[1]))),
+                    _mm_add_ps(_mm_mul_ps(z, _mm_load_ps(bone.axes[2])), _mm_load_ps(bone.axes[3])));
+                result = _mm_add_ps(result, _mm_mul_ps(transformed, _mm_set1_ps(weights[k])));
+            }
+            Store(mesh.animVertices + v * 3, result);
+
+            if (skinNormals) {
+                const float* normal = mesh.normals + v * 3;
+                const __m128 nx = _mm_set1_ps(normal[0]);
+                const __m128 ny = _mm_set1_ps(normal[1]);
+                const __m128 nz = _mm_set1_ps(normal[2]);
+                result = _mm_setzero_ps();
+                for (size_t k = 0; k < 4; k++) {
+                    if (weights[k] == 0.0f || ids[k] >= boneCount) {
+                        continue;
+                    }
+                    const Affine& bone = normalPalette[ids[k]];
+                    __m128 transformed = _mm_add_ps(
+                        _mm_add_ps(
+                            _mm_mul_ps(nx, _mm_load_ps(bone.axes[0])),
+                            _mm_mul_ps(ny, _mm_load_ps(bone.axes[1]))),
+                        _mm_mul_ps(nz, _mm_load_ps(bone.axes[2])));
+                    result = _mm_add_ps(result, _mm_mul_ps(transformed, _mm_set1_ps(weights[k])));
+                }
+                Store(mesh.animNormals + v * 3, result);
+            }
+#else
+            float result[3]{};
+            for (size_t k = 0; k < 4; k++) {
+                if (weights[k] == 0.0f || ids[k] >= boneCount) {
+                    continue;
+                }
+                const Affine& bone = palette[ids[k]];
+                for (size_t axis = 0; axis < 3; axis++) {
+                    result[axis] += weights[k] * (position[0] * bone.axes[0][axis] + position[1] * bone.axes[1][axis] +
+                                                  position[2] * bone.axes[2][axis] + bone.axes[3][axis]);
+                }
+            }
+            std::copy(result, result + 3, mesh.animVertices + v * 3);
+
+            if (skinNormals) {
+                const float* normal = mesh.normals + v * 3;
+                float normalResult[3]{};
+                for (size_t k = 0; k < 4; k++) {
+                    if (weights[k] == 0.0f || ids[k] >= boneCount) {
+                        continue;
+                    }
+                    const Affine& bone = normalPalette[ids[k]];
+                    for (size_t axis = 0; axis < 3; axis++) {
+                        normalResult[axis] += weights[k] * (normal[0] * bone.axes[0][axis] +
+                                                            normal[1] * bone.axes[1][axis] +
+                                                            normal[2] * bone.axes[2][axis]);
+                    }
+                }
+                std::copy(normalResult, normalResult + 3, mesh.animNormals + v * 3);
+            }
+#endif
+        }
+    }
+
+#ifdef RAYLIB_CPP_SSE2
+    /**
+     * Store the first three lanes, without touching the float after them.
+     */
+    static void Store(float* destination, __m128 value) {
+        _mm_storel_pi(reinterpret_cast<__m64*>(destination), value);
+        _mm_store_ss(destination + 2, _mm_movehl_ps(value, value));
+    }
+#endif
+
+    static void Upload(const ::Mesh& mesh) {
+        if (mesh.vboId == nullptr || mesh.animVertices == nullptr) {
+            return;
+        }
+        const int size = mesh.vertexCount * 3 * static_cast<int>(sizeof(float));
+        // Buffer 0 holds the positions and buffer 2 the normals, see ::UploadMesh()
+        ::UpdateMeshBuffer(mesh, 0, mesh.animVertices, size, 0);
+        if (mesh.animNormals != nullptr) {
+            ::UpdateMeshBuffer(mesh, 2, mesh.animNormals, size, 0);
+        }
+    }
+
+    /**
+     * Scale, then rotate, then translate, matching the order ::UpdateModelAnimationBones() composes them in.
+     */
+    static Affine FromTransform(const ::Transform& transform) {
+        const ::Quaternion& q = transform.rotation;
+        const float xx = q.x * q.x;
+        const float yy = q.y * q.y;
+        const float zz = q.z * q.z;
+        const float xy = q.x * q.y;
+        const float xz = q.x * q.z;
+        const float yz = q.y * q.z;
+        const float wx = q.w * q.x;
+        const float wy = q.w * q.y;
+        const float wz = q.w * q.z;
+        const float scale[3] = {transform.scale.x, transform.scale.y, transform.scale.z};
+        const float rotation[3][3] = {
+            {1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy)},
+            {2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx)},
+            {2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy)}};
+
+        Affine result;
+        for (size_t axis = 0; axis < 3; axis++) {
+            for (size_t row = 0; row < 3; row++) {
+                result.axes[axis][row] = rotation[axis][row] * scale[axis];
+            }
+        }
+        result.axes[3][0] = transform.translation.x;
+        result.axes[3][1] = transform.translation.y;
+        result.axes[3][2] = transform.translation.z;
+        return result;
+    }
+
+    static Affine FromMatrix(const ::Matrix& m) {
+        Affine result;
+        const float columns[4][3] = {
+            {m.m0, m.m1, m.m2},
+            {m.m4, m.m5, m.m6},
+            {m.m8, m.m9, m.m10},
+            {m.m12, m.m13, m.m14}};
+        for (size_t axis = 0; axis < 4; axis++) {
+            std::copy(columns[axis], columns[axis] + 3, result.axes[axis]);
+        }
+        return result;
+    }
+
+    static ::Matrix ToMatrix(const Affine& a) {
+        return {
+            a.axes[0][0], a.axes[1][0], a.axes[2][0], a.axes[3][0],
+            a.axes[0][1], a.axes[1][1], a.axes[2][1], a.axes[3][1],
+            a.axes[0][2], a.axes[1][2], a.axes[2][2], a.axes[3][2],
+            0.0f, 0.0f, 0.0f, 1.0f};
+    }
+
+    /**
+     * Apply b, then a.
+     */
+    static Affine Multiply(const Affine& a, const Affine& b) {
+        Affine result;
+        for (size_t axis = 0; axis < 4; axis++) {
+            for (size_t row = 0; row < 3; row++) {
+                result.axes[axis][row] = a.axes[0][row] * b.axes[axis][0] + a.axes[1][row] * b.axes[axis][1] +
+                                         a.axes[2][row] * b.axes[axis][2];
+            }
+        }
+        for (size_t row = 0; row < 3; row++) {
+            result.axes[3][row] += a.axes[3][row];
+        }
+        return result;
+    }
+
+    static void Cross(const float* a, const float* b, float* result) {
+        result[0] = a[1] * b[2] - a[2] * b[1];
+        result[1] = a[2] * b[0] - a[0] * b[2];
+        result[2] = a[0] * b[1] - a[1] * b[0];
+    }
+
+    /**
+     * Inverse transpose of the 3x3 part, whose axes are the cross products of the original axes over the determinant.
+     */
+    static Affine NormalMatrix(const Affine& a) {
+        Affine result;
+        Cross(a.axes[1], a.axes[2], result.axes[0]);
+        Cross(a.axes[2], a.axes[0], result.axes[1]);
+        Cross(a.axes[0], a.axes[1], result.axes[2]);
+        const float determinant = a.axes[0][0] * result.axes[0][0] + a.axes[0][1] * result.axes[0][1] +
+                                  a.axes[0][2] * result.axes[0][2];
+        const float scale = determinant != 0.0f ? 1.0f / determinant : 0.0f;
+        for (size_t axis = 0; axis < 3; axis++) {
+            for (size_t row = 0; row < 3; row++) {
+                result.axes[axis][row] *= scale;
+            }
+        }
+        return result;
+    }
+
+    static Affine Invert(const Affine& a) {
+        // The inverse is the transpose of the normal matrix
+        const Affine normal = NormalMatrix(a);
+        Affine result;
+        for (size_t axis = 0; axis < 3; axis++) {
+            for (size_t row = 0; row < 3; row++) {
+                result.axes[axis][row] = normal.axes[row][axis];
+            }
+        }
+        for (size_t row = 0; row < 3; row++) {
+            result.axes[3][row] = -(result.axes[0][row] * a.axes[3][0] + result.axes[1][row] * a.axes[3][1] +
+                                    result.axes[2][row] * a.axes[3][2]);
+        }
+        return result;
+    }
+
+    ThreadPool* pool{nullptr};
+    std::unordered_map<const ::Mesh*, ModelState> models{};
+    size_t generation{0};
+    size_t skinnedMeshCount{0};
+    size_t skippedMeshCount{0};
+    size_t skinnedVertexCount{0};
+};
+} // namespace raylib
+
+using RSkinningEngine = raylib::SkinningEngine;
+
+#endif // RAYLIB_CPP_INCLUDE_SKINNINGENGINE_HPP_
@@ -0,0 +1,314 @@
+#ifndef RAYLIB_CPP_INCLUDE_SPATIALHASH_HPP_
+#define RAYLIB_CPP_INCLUDE_SPATIALHASH_HPP_
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "./BroadPhase.hpp"
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Uniform grid broad phase over ::Rectangle or ::BoundingBox bounds, to find overlaps without testing every pair.
+ *
+ * Every object is filed in the grid cells its bounds touch, the unbounded grid being folded into a fixed number of
+ * buckets. Works best with objects of similar size and a cell a little larger than a typical object, use an AABBTree
+ * when sizes vary a lot.
+ *
+ * Inserting, moving and removing objects only records their bounds. The next query sorts all objects into the
+ * buckets in one linear pass, which when most objects move every frame is cheaper than moving each between buckets,
+ * and leaves every bucket's entries packed together for the pair tests.
+ *
+ * @code
+ * raylib::SpatialHash<::Rectangle> grid(64.0f);
+ * int player = grid.Insert(playerRec);
+ * grid.Update(player, playerRec);
+ * grid.GetPairs(pairs);
+ * @endcode
+ */
+template<typename Bounds>
+class SpatialHash {
+public:
+    /**
+     * @param cellSize Width of the cubic cells.
+     * @param bucketCount Buckets the cells are hashed to, rounded up to a power of two.
+     *
+     * @throws raylib::RaylibException Throws if the cell size is not positive.
+     */
+    explicit SpatialHash(float cellSize, size_t bucketCount = 16384)
+        : inverseCellSize(1.0f / cellSize),
+          bucketShift(32 - std::countr_zero(std::bit_ceil(std::clamp<size_t>(bucketCount, 2, size_t{1} << 31)))),
+          bucketStarts((size_t{1} << (32 - bucketShift)) + 1) {
+        if (!(cellSize > 0.0f)) {
+            throw RaylibException("SpatialHash requires a positive cell size");
+        }
+    }
+
+    /**
+     * Add an object.
+     *
+     * @return Its id, reused once it is removed.
+     */
+    int Insert(const Bounds& bounds) {
+        int id;
+        if (freeIds.empty()) {
+            id = static_cast<int>(objects.size());
+            objects.emplace_back();
+        } else {
+            id = freeIds.back();
+            freeIds.pop_back();
+        }
+        Object& object = objects[static_cast<size_t>(id)];
+        object.bounds = bounds;
+        object.box = BroadPhase<Bounds>::ToBox(bounds);
+        object.alive = true;
+        count++;
+        dirty = true;
+        return id;
+    }
+
+    /**
+     * Move an object.
+     *
+     * @throws raylib::RaylibException Throws if the id is not of an object in the grid.
+     */
+    void Update(int id, const Bounds& bounds) {
+        Object& object = objects[CheckId(id)];
+        object.bounds = bounds;
+        object.box = BroadPhase<Bounds>::ToBox(bounds);
+        dirty = true;
+    }
+
+    /**
+     * @throws raylib::RaylibException Throws if the id is not of an object in the grid.
+     */
+    void Remove(int id) {
+        objects[CheckId(id)].alive = false;
+        freeIds.push_back(id);
+        count--;
+        dirty = true;
+    }
+
+    [[nodiscard]] bool IsValid(int id) const {
+        return id >= 0 && static_cast<size_t>(id) < objects.size() && objects[static_cast<size_t>(id)].alive;
+    }
+
+    /**
+     * @throws raylib::RaylibException Throws if the id is not of an object in the grid.
+     */
+    [[nodiscard]] const Bounds& GetBounds(int id) const { return objects[CheckId(id)].bounds; }
+
+    /**
+     * Append the ids of the objects overlapping the region, each once.
+     *
+     * @return The number of ids appended.
+     */
+    size_t Query(const Bounds& region, std::vector<int>& result) {
+        Sort();
+        const ::BoundingBox box = BroadPhase<Bounds>::ToBox(region);
+        const Cell first = GetCell(box.min);
+        const Cell last = GetCell(box.max);
+        const size_t before = result.size();
+        for (int z = first.z; z <= last.z; z++) {
+            for (int y = first.y; y <= last.y; y++) {
+                for (int x = first.x; x <= last.x; x++) {
+                    const size_t bucket = GetBucket({x, y, z});
+                    for (size_t i = bucketStarts[bucket]; i < bucketStarts[bucket + 1]; i++) {
+                        const Entry& entry = entries[i];
+                        // Found in every cell both span, so only the first of those reports it
+                        if (x == std::max(entry.cell.x, first.x) && y == std::max(entry.cell.y, first.y) &&
+                            z == std::max(entry.cell.z, first.z) && BroadPhase<Bounds>::Overlaps(entry.box, box)) {
+                            result.push_back(entry.id);
+                        }
+                    }
+                }
+            }
+        }
+        return result.size() - before;
+    }
+
+    /**
+     * Append every pair of overlapping objects once, the lower id first.
+     *
+     * @return The number of pairs appended.
+     */
+    size_t GetPairs(std::vector<std::pair<int, int>>& pairs) {
+        Sort();
+        const size_t before = pairs.size();
+        for (size_t bucket = 0; bucket + 1 < bucketStarts.size(); bucket++) {
+            const size_t end = bucketStarts[bucket + 1];
+            for (size_t i = bucketStarts[bucket]; i < end; i++) {
+                const Entry& a = entries[i];
+                for (size_t j = i + 1; j < end; j++) {
+                    const Entry& b = entries[j];
+                    if (!BroadPhase<Bounds>::Overlaps(a.box, b.box)) {
+                        continue;
+                    }
+                    // Both are filed in every cell they share, the first of those reports the pair
+                    const Cell owner{std::max(a.cell.x, b.cell.x), std::max(a.cell.y, b.cell.y),
+                                     std::max(a.cell.z, b.cell.z)};
+                    if (GetBucket(owner) == bucket) {
+                        pairs.emplace_back(std::min(a.id, b.id), std::max(a.id, b.id));
+                    }
+                }
+            }
+        }
+        return pairs.size() - before;
+    }
+
+    void Clear() {
+        objects.clear();
+        freeIds.clear();
+        entries.clear();
+        std::fill(bucketStarts.begin(), bucketStarts.end(), 0);
+        count = 0;
+        dirty = false;
+    }
+
+    [[nodiscard]] size_t GetCount() const { return count; }
+
+    [[nodiscard]] float GetCellSize() const { return 1.0f / inverseCellSize; }
+
+    [[nodiscard]] size_t GetBucketCount() const { return bucketStarts.size() - 1; }
+protected:
+    struct Cell {
+        int x{0};
+        int y{0};
+        int z{0};
+    };
+
+    struct Object {
+        Bounds bounds{};
+        ::BoundingBox box{};
+        /** Cells touched as of the last Sort() */
+        Cell first{};
+        Cell last{};
+        uint32_t bucketCount{0};
+        bool alive{false};
+    };
+
+    /**
+     * An object filed in a bucket, with the first cell it touches
+     */
+    struct Entry {
+        ::BoundingBox box{};
+        Cell cell{};
+        int id{0};
+    };
+
+    size_t CheckId(int id) const {
+        if (!IsValid(id)) {
+            throw RaylibException("SpatialHash has no object with that id");
+        }
+        return static_cast<size_t>(id);
+    }
+
+    [[nodiscard]] Cell GetCell(::Vector3 position) const {
+        return {Floor(position.x * inverseCellSize), Floor(position.y * inverseCellSize),
+                Floor(position.z * inverseCellSize)};
+    }
+
+    /**
+     * Without SSE4.1 std::floor() is a library call, which would dominate sorting
+     */
+    static int Floor(float value) {
+        const auto truncated = static_cast<int>(value);
+        return truncated - (value < static_cast<float>(truncated) ? 1 : 0);
+    }
+
+    [[nodiscard]] uint32_t GetBucket(const Cell& cell) const {
+        const uint32_t hash = (static_cast<uint32_t>(cell.x) * 73856093u) ^
+                              (static_cast<uint32_t>(cell.y) * 19349663u) ^
+                              (static_cast<uint32_t>(cell.z) * 83492791u);
+        // The product's high bits depend on all bits of the hash, its low bits only on the low bits of the cells
+        return (hash * 2654435769u) >> bucketShift;
+    }
+
+    /**
+     * Counting sort of the objects into the buckets, if any changed since the last one.
+     */
+    void Sort() {
+        if (!dirty) {
+            return;
+        }
+        dirty = false;
+        std::fill(bucketStarts.begin(), bucketStarts.end(), 0);
+        objectBuckets.clear();
+        for (Object& object : objects) {
+            if (!object.alive) {
+                continue;
+            }
+            object.first = GetCell(object.box.min);
+            object.last = GetCell(object.box.max);
+            const size_t begin = objectBuckets.size();
+            for (int z = object.first.z; z <= object.last.z; z++) {
+                for (int y = object.first.y; y <= object.last.y; y++) {
+                    for (int x = object.first.x; x <= object.last.x; x++) {
+                        objectBuckets.push_back(GetBucket({x, y, z}));
+                    }
+                }
+            }
+
+            // Cells hashed to the same bucket share the entry
+            const auto first = objectBuckets.begin() + static_cast<std::ptrdiff_t>(begin);
+            auto last = objectBuckets.end();
+            if (last - first > 16) {
+                std::sort(first, last);
+                last = std::unique(first, last);
+            } else {
+                for (auto bucket = first + 1; bucket < last;) {
+                    if (std::find(first, bucket, *bucket) != bucket) {
+                        *bucket = *--last;
+                    } else {
+                        ++bucket;
+                    }
+                }
+            }
+            objectBuckets.erase(last, objectBuckets.end());
+            object.bucketCount = static_cast<uint32_t>(objectBuckets.size() - begin);
+            for (auto bucket = first; bucket != last; ++bucket) {
+                bucketStarts[*bucket + 1]++;
+            }
+        }
+        for (size_t bucket = 1; bucket < bucketStarts.size(); bucket++) {
+            bucketStarts[bucket] += bucketStarts[bucket - 1];
+        }
+
+        // Fill each bucket from its start, which leaves the starts shifted to the next bucket's
+        entries.resize(bucketStarts.back());
+        size_t next = 0;
+        for (size_t id = 0; id < objects.size(); id++) {
+            const Object& object = objects[id];
+            for (uint32_t i = 0; object.alive && i < object.bucketCount; i++) {
+                entries[bucketStarts[objectBuckets[next++]]++] = {object.box, object.first, static_cast<int>(id)};
+            }
+        }
+        std::copy_backward(bucketStarts.begin(), bucketStarts.end() - 1, bucketStarts.end());
+        bucketStarts[0] = 0;
+    }
+
+    float inverseCellSize{1.0f};
+    int bucketShift{18};
+    std::vector<Object> objects{};
+    std::vector<int> freeIds{};
+    /** Entries sorted by bucket, the bucket's start for each and the total at the end */
+    std::vector<Entry> entries{};
+    std::vector<size_t> bucketStarts{};
+    /** Buckets of each object in turn, as of the last Sort() */
+    std::vector<uint32_t> objectBuckets{};
+    size_t count{0};
+    bool dirty{false};
+};
+} // namespace raylib
+
+template<typename Bounds>
+using RSpatialHash = raylib::SpatialHash<Bounds>;
+
+#endif // RAYLIB_CPP_INCLUDE_SPATIALHASH_HPP_
@@ -0,0 +1,471 @@
+#ifndef RAYLIB_CPP_INCLUDE_SWEPTCOLLISION_HPP_
+#define RAYLIB_CPP_INCLUDE_SWEPTCOLLISION_HPP_
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Continuous collision tests, finding when a shape moving in a straight line first touches another so fast objects
+ * cannot tunnel through thin ones between frames.
+ *
+ * Every test returns a ::RayCollision where distance is the time of impact, the fraction of the motion travelled
+ * before contact from 0 to 1, normal is the unit contact normal pointing from the obstacle towards the mover and
+ * point is where they touch. Shapes already overlapping hit at 0 with the normal the shortest way out, shapes only
+ * touching hit when moving into each other and not when sliding along or moving apart.
+ *
+ * The sweeps are ray casts against the obstacle grown by the moving shape, and for meshes
+ * MeshBVH::GetCollision({position, motion}, 1.0f) gives the same fraction for a moving point.
+ *
+ * @code
+ * ::RayCollision hit = raylib::SweptCollision::Sweep(bullet, velocity * dt, wall);
+ * if (hit.hit) {
+ *     position += velocity * dt * hit.distance;
+ * }
+ * @endcode
+ */
+class SweptCollision {
+public:
+    /**
+     * Rectangle moving by motion against another, the normal along x or y.
+     */
+    static ::RayCollision Sweep(const ::Rectangle& moving, ::Vector2 motion, const ::Rectangle& obstacle) {
+        return SweepBoxes(
+            {{moving.x, moving.y, 0.0f}, {moving.x + moving.width, moving.y + moving.height, 0.0f}},
+            {motion.x, motion.y, 0.0f},
+            {{obstacle.x, obstacle.y, 0.0f}, {obstacle.x + obstacle.width, obstacle.y + obstacle.height, 0.0f}},
+            2);
+    }
+
+    /**
+     * Box moving by motion against another, the normal along an axis.
+     */
+    static ::RayCollision Sweep(const ::BoundingBox& moving, ::Vector3 motion, const ::BoundingBox& obstacle) {
+        return SweepBoxes(moving, motion, obstacle, 3);
+    }
+
+    /**
+     * Sphere moving by motion against a box, rounding off its edges and corners.
+     */
+    static ::RayCollision Sweep(::Vector3 center, float radius, ::Vector3 motion, const ::BoundingBox& obstacle) {
+        const ::Vector3 closest = Clamp(center, obstacle);
+        const ::Vector3 offset = Subtract(center, closest);
+        const float distanceSquared = Dot(offset, offset);
+        if (distanceSquared < radius * radius) {
+            if (distanceSquared > 0.0f) {
+                return {true, 0.0f, closest, Scale(offset, 1.0f / std::sqrt(distanceSquared))};
+            }
+            return {true, 0.0f, center, GetExit(center, obstacle, 3)};
+        }
+
+        // The box grown by the radius on every side, whose edges and corners stick out past the rounded shape
+        const ::BoundingBox grown{
+            {obstacle.min.x - radius, obstacle.min.y - radius, obstacle.min.z - radius},
+            {obstacle.max.x + radius, obstacle.max.y + radius, obstacle.max.z + radius}};
+        float enter = 0.0f;
+        float exit = 0.0f;
+        int axis = 0;
+        if (!Slab(center, motion, grown, 3, enter, exit, axis) || enter >= exit || exit <= 0.0f || enter > 1.0f) {
+            return {};
+        }
+        const float fraction = std::max(enter, 0.0f);
+        const ::Vector3 position = Add(center, Scale(motion, fraction));
+
+        // Past the box on one axis at most is a face, on two an edge and on three a corner
+        ::Vector3 corner{};
+        int outside = 0;
+        int inside = 0;
+        for (int i = 0; i < 3; i++) {
+            const float value = At(position, i);
+            if (value < At(obstacle.min, i)) {
+                At(corner, i) = At(obstacle.min, i);
+                outside++;
+            } else if (value > At(obstacle.max, i)) {
+                At(corner, i) = At(obstacle.max, i);
+                outside++;
+            } else {
+                inside = i;
+            }
+        }
+        if (outside <= 1) {
+            ::Vector3 normal{};
+            At(normal, axis) = At(motion, axis) > 0.0f ? -1.0f : 1.0f;
+            return {true, fraction, Subtract(position, Scale(normal, radius)), normal};
+        }
+        if (outside == 2) {
+            ::Vector3 start = corner;
+            ::Vector3 end = corner;
+            At(start, inside) = At(obstacle.min, inside);
+            At(end, inside) = At(obstacle.max, inside);
+            return CastCapsule(center, motion, start, end, radius);
+        }
+        ::RayCollision nearest{};
+        for (int i = 0; i < 3; i++) {
+            ::Vector3 end = corner;
+            At(end, i) = At(corner, i) == At(obstacle.min, i) ? At(obstacle.max, i) : At(obstacle.min, i);
+            Closest(nearest, CastCapsule(center, motion, corner, end, radius));
+        }
+        return nearest;
+    }
+
+    /**
+     * Sphere moving by motion against a triangle, from either side.
+     */
+    static ::RayCollision Sweep(
+        ::Vector3 center,
+        float radius,
+        ::Vector3 motion,
+        ::Vector3 p1,
+        ::Vector3 p2,
+        ::Vector3 p3) {
+        ::Vector3 normal = Cross(Subtract(p2, p1), Subtract(p3, p1));
+        const float area = std::sqrt(Dot(normal, normal));
+        normal = area > 0.0f ? Scale(normal, 1.0f / area) : normal;
+
+        const ::Vector3 closest = ClosestPoint(center, p1, p2, p3);
+        const ::Vector3 offset = Subtract(center, closest);
+        const float distanceSquared = Dot(offset, offset);
+        if (distanceSquared < radius * radius) {
+            if (distanceSquared > 0.0f) {
+                return {true, 0.0f, closest, Scale(offset, 1.0f / std::sqrt(distanceSquared))};
+            }
+            return {true, 0.0f, closest, Dot(normal, motion) > 0.0f ? Negate(normal) : normal};
+        }
+
+        if (area > 0.0f) {
+            float distance = Dot(Subtract(center, p1), normal);
+            if (distance < 0.0f) {
+                normal = Negate(normal);
+                distance = -distance;
+            }
+            // Nothing is touched before the sphere reaches the plane
+            const float speed = -Dot(motion, normal);
+            if (distance >= radius) {
+                if (speed <= 0.0f || distance - radius > speed) {
+                    return {};
+                }
+                const float fraction = (distance - radius) / speed;
+                const ::Vector3 contact = Subtract(Add(center, Scale(motion, fraction)), Scale(normal, radius));
+                if (Contains(contact, p1, p2, p3, normal)) {
+                    return {true, fraction, contact, normal};
+                }
+            }
+        }
+
+        ::RayCollision nearest = CastCapsule(center, motion, p1, p2, radius);
+        Closest(nearest, CastCapsule(center, motion, p2, p3, radius));
+        Closest(nearest, CastCapsule(center, motion, p3, p1, radius));
+        return nearest;
+    }
+
+    /**
+     * Point moving by motion against a box.
+     */
+    static ::RayCollision Cast(::Vector3 position, ::Vector3 motion, const ::BoundingBox& obstacle) {
+        return SweepBoxes({position, position}, motion, obstacle, 3);
+    }
+
+    /**
+     * Point moving by motion against a sphere.
+     */
+    static ::RayCollision Cast(::Vector3 position, ::Vector3 motion, ::Vector3 center, float radius) {
+        const ::Vector3 offset = Subtract(position, center);
+        const float distanceSquared = Dot(offset, offset);
+        if (distanceSquared < radius * radius) {
+            const ::Vector3 normal = distanceSquared > 0.0f ? Scale(offset, 1.0f / std::sqrt(distanceSquared))
+                                                            : Negate(Normalize(motion));
+            return {true, 0.0f, Add(center, Scale(normal, radius)), normal};
+        }
+        return CastSphere(position, motion, center, radius);
+    }
+
+    /**
+     * Point moving by motion against a triangle, from either side.
+     */
+    static ::RayCollision Cast(::Vector3 position, ::Vector3 motion, ::Vector3 p1, ::Vector3 p2, ::Vector3 p3) {
+        const ::Vector3 edge1 = Subtract(p2, p1);
+        const ::Vector3 edge2 = Subtract(p3, p1);
+        const ::Vector3 p = Cross(motion, edge2);
+        const float determinant = Dot(edge1, p);
+        if (determinant == 0.0f) {
+            return {};
+        }
+        const float inverse = 1.0f / determinant;
+        const ::Vector3 offset = Subtract(position, p1);
+        const float u = Dot(offset, p) * inverse;
+        if (u < 0.0f || u > 1.0f) {
+            return {};
+        }
+        const ::Vector3 q = Cross(offset, edge1);
+        const float v = Dot(motion, q) * inverse;
+        if (v < 0.0f || u + v > 1.0f) {
+            return {};
+        }
+        const float fraction = Dot(edge2, q) * inverse;
+        if (fraction < 0.0f || fraction > 1.0f) {
+            return {};
+        }
+        const ::Vector3 normal = Normalize(Cross(edge1, edge2));
+        return {
+            true,
+            fraction,
+            Add(position, Scale(motion, fraction)),
+            Dot(normal, motion) > 0.0f ? Negate(normal) : normal};
+    }
+protected:
+    /**
+     * The moving box's center cast against the obstacle grown by its half size, on the first axes only.
+     */
+    static ::RayCollision SweepBoxes(
+        const ::BoundingBox& moving,
+        ::Vector3 motion,
+        const ::BoundingBox& obstacle,
+        int axes) {
+        const ::Vector3 center = Scale(Add(moving.min, moving.max), 0.5f);
+        ::BoundingBox grown = obstacle;
+        for (int i = 0; i < axes; i++) {
+            const float half = (At(moving.max, i) - At(moving.min, i)) * 0.5f;
+            At(grown.min, i) -= half;
+            At(grown.max, i) += half;
+        }
+
+        // Already overlapping, pushed out through the nearest side
+        bool overlapping = true;
+        for (int i = 0; i < axes; i++) {
+            overlapping = overlapping && At(center, i) > At(grown.min, i) && At(center, i) < At(grown.max, i);
+        }
+        if (overlapping) {
+            return {true, 0.0f, Clamp(center, obstacle), GetExit(center, grown, axes)};
+        }
+
+        float enter = 0.0f;
+        float exit = 0.0f;
+        int axis = 0;
+        if (!Slab(center, motion, grown, axes, enter, exit, axis) || enter >= exit || enter < 0.0f ||
+            enter > 1.0f) {
+            return {};
+        }
+        ::Vector3 normal{};
+        At(normal, axis) = At(motion, axis) > 0.0f ? -1.0f : 1.0f;
+        return {true, enter, Clamp(Add(center, Scale(motion, enter)), obstacle), normal};
+    }
+
+    /**
+     * Normal of the side of the box nearest to a point within it.
+     */
+    static ::Vector3 GetExit(::Vector3 position, const ::BoundingBox& box, int axes) {
+        float shallowest = FLT_MAX;
+        ::Vector3 normal{};
+        for (int i = 0; i < axes; i++) {
+            const float below = At(position, i) - At(box.min, i);
+            const float above = At(box.max, i) - At(position, i);
+            if (std::min(below, above) < shallowest) {
+                shallowest = std::min(below, above);
+                normal = {};
+                At(normal, i) = below < above ? -1.0f : 1.0f;
+            }
+        }
+        return normal;
+    }
+
+    /**
+     * Fractions of the motion at which the point enters and leaves the box, and the axis it enters through.
+     *
+     * @return False if the point does not move on an axis it lies outside of or on the edge of.
+     */
+    static bool Slab(
+        ::Vector3 position,
+        ::Vector3 motion,
+        const ::BoundingBox& box,
+        int axes,
+        float& enter,
+        float& exit,
+        int& axis) {
+        enter = -FLT_MAX;
+        exit = FLT_MAX;
+        for (int i = 0; i < axes; i++) {
+            const float value = At(position, i);
+            const float speed = At(motion, i);
+            const float min = At(box.min, i);
+            const float max = At(box.max, i);
+            if (speed == 0.0f) {
+                if (value <= min || value >= max) {
+                    return false;
+                }
+                continue;
+            }
+            const float first = (min - value) / speed;
+            const float second = (max - value) / speed;
+            if (std::min(first, second) > enter) {
+                enter = std::min(first, second);
+                axis = i;
+            }
+            exit = std::min(exit, std::max(first, second));
+        }
+        return true;
+    }
+
+    /**
+     * Point against the segment grown by the radius, i.e. a cylinder capped by two spheres.
+     */
+    static ::RayCollision CastCapsule(
+        ::Vector3 position,
+        ::Vector3 motion,
+        ::Vector3 start,
+        ::Vector3 end,
+        float radius) {
+        // The caps touch the obstacle at the ends of the segment
+        const auto cap = [&](::Vector3 center) {
+            ::RayCollision hit = CastSphere(position, motion, center, radius);
+            hit.point = hit.hit ? center : hit.point;
+            return hit;
+        };
+        ::RayCollision nearest = cap(start);
+        Closest(nearest, cap(end));
+
+        const ::Vector3 segment = Subtract(end, start);
+        const float length = std::sqrt(Dot(segment, segment));
+        if (length == 0.0f) {
+            return nearest;
+        }
+        // Solve on the plane across the segment, where the cylinder is a circle
+        const ::Vector3 direction = Scale(segment, 1.0f / length);
+        const ::Vector3 offset = Subtract(position, start);
+        const ::Vector3 across = Subtract(offset, Scale(direction, Dot(offset, direction)));
+        const ::Vector3 speed = Subtract(motion, Scale(direction, Dot(motion, direction)));
+        const float a = Dot(speed, speed);
+        const float b = Dot(across, speed);
+        const float c = Dot(across, across) - radius * radius;
+        const float discriminant = b * b - a * c;
+        if (a == 0.0f || c < 0.0f || b >= 0.0f || discriminant < 0.0f) {
+            return nearest;
+        }
+        const float fraction = c == 0.0f ? 0.0f : (-b - std::sqrt(discriminant)) / a;
+        if (fraction > 1.0f || (nearest.hit && fraction >= nearest.distance)) {
+            return nearest;
+        }
+        const ::Vector3 point = Add(position, Scale(motion, fraction));
+        const float along = Dot(Subtract(point, start), direction);
+        if (along < 0.0f || along > length) {
+            return nearest;
+        }
+        const ::Vector3 axisPoint = Add(start, Scale(direction, along));
+        return {true, fraction, axisPoint, Scale(Subtract(point, axisPoint), 1.0f / radius)};
+    }
+
+    /**
+     * Point from outside of the sphere against it.
+     */
+    static ::RayCollision CastSphere(::Vector3 position, ::Vector3 motion, ::Vector3 center, float radius) {
+        const ::Vector3 offset = Subtract(position, center);
+        const float a = Dot(motion, motion);
+        const float b = Dot(offset, motion);
+        const float c = Dot(offset, offset) - radius * radius;
+        const float discriminant = b * b - a * c;
+        if (a == 0.0f || b >= 0.0f || discriminant < 0.0f) {
+            return {};
+        }
+        const float fraction = c <= 0.0f ? 0.0f : (-b - std::sqrt(discriminant)) / a;
+        if (fraction > 1.0f) {
+            return {};
+        }
+        const ::Vector3 point = Add(position, Scale(motion, fraction));
+        const ::Vector3 normal =
+            radius > 0.0f ? Scale(Subtract(point, center), 1.0f / radius) : Negate(Normalize(motion));
+        return {true, fraction, point, normal};
+    }
+
+    /**
+     * Keep the earlier of two hits.
+     */
+    static void Closest(::RayCollision& nearest, const ::RayCollision& collision) {
+        if (collision.hit && (!nearest.hit || collision.distance < nearest.distance)) {
+            nearest = collision;
+        }
+    }
+
+    /**
+     * Point of the triangle closest to the position, by which of its corners, edges or face the position lies
+     * beyond.
+     */
+    static ::Vector3 ClosestPoint(::Vector3 position, ::Vector3 a, ::Vector3 b, ::Vector3 c) {
+        const ::Vector3 ab = Subtract(b, a);
+        const ::Vector3 ac = Subtract(c, a);
+        const ::Vector3 ap = Subtract(position, a);
+        const float d1 = Dot(ab, ap);
+        const float d2 = Dot(ac, ap);
+        if (d1 <= 0.0f && d2 <= 0.0f) {
+            return a;
+        }
+        const ::Vector3 bp = Subtract(position, b);
+        const float d3 = Dot(ab, bp);
+        const float d4 = Dot(ac, bp);
+        if (d3 >= 0.0f && d4 <= d3) {
+            return b;
+        }
+        const float vc = d1 * d4 - d3 * d2;
+        if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+            return Add(a, Scale(ab, d1 / (d1 - d3)));
+        }
+        const ::Vector3 cp = Subtract(position, c);
+        const float d5 = Dot(ab, cp);
+        const float d6 = Dot(ac, cp);
+        if (d6 >= 0.0f && d5 <= d6) {
+            return c;
+        }
+        const float vb = d5 * d2 - d1 * d6;
+        if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+            return Add(a, Scale(ac, d2 / (d2 - d6)));
+        }
+        const float va = d3 * d6 - d5 * d4;
+        if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f) {
+            return Add(b, Scale(Subtract(c, b), (d4 - d3) / ((d4 - d3) + (d5 - d6))));
+        }
+        const float denominator = 1.0f / (va + vb + vc);
+        return Add(a, Add(Scale(ab, vb * denominator), Scale(ac, vc * denominator)));
+    }
+
+    /**
+     * Whether a point on the triangle's plane lies within it
+     */
+    static bool Contains(::Vector3 point, ::Vector3 a, ::Vector3 b, ::Vector3 c, ::Vector3 normal) {
+        const float ab = Dot(Cross(Subtract(b, a), Subtract(point, a)), normal);
+        const float bc = Dot(Cross(Subtract(c, b), Subtract(point, b)), normal);
+        const float ca = Dot(Cross(Subtract(a, c), Subtract(point, c)), normal);
+        return (ab >= 0.0f && bc >= 0.0f && ca >= 0.0f) || (ab <= 0.0f && bc <= 0.0f && ca <= 0.0f);
+    }
+
+    static ::Vector3 Clamp(::Vector3 position, const ::BoundingBox& box) {
+        return {
+            std::clamp(position.x, box.min.x, box.max.x),
+            std::clamp(position.y, box.min.y, box.max.y),
+            std::clamp(position.z, box.min.z, box.max.z)};
+    }
+
+    static float& At(::Vector3& v, int axis) { return axis == 0 ? v.x : axis == 1 ? v.y : v.z; }
+    static float At(const ::Vector3& v, int axis) { return axis == 0 ? v.x : axis == 1 ? v.y : v.z; }
+
+    static ::Vector3 Add(::Vector3 a, ::Vector3 b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+    static ::Vector3 Subtract(::Vector3 a, ::Vector3 b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+    static ::Vector3 Scale(::Vector3 v, float s) { return {v.x * s, v.y * s, v.z * s}; }
+    static ::Vector3 Negate(::Vector3 v) { return {-v.x, -v.y, -v.z}; }
+    static float Dot(::Vector3 a, ::Vector3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+    static ::Vector3 Cross(::Vector3 a, ::Vector3 b) {
+        return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+    }
+
+    static ::Vector3 Normalize(::Vector3 v) {
+        const float length = std::sqrt(Dot(v, v));
+        return length > 0.0f ? Scale(v, 1.0f / length) : v;
+    }
+};
+} // namespace raylib
+
+using RSweptCollision = raylib::SweptCollision;
+
+#endif // RAYLIB_CPP_INCLUDE_SWEPTCOLLISION_HPP_
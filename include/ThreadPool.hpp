@@ -0,0 +1,184 @@
+#ifndef RAYLIB_CPP_INCLUDE_THREADPOOL_HPP_
+#define RAYLIB_CPP_INCLUDE_THREADPOOL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace raylib {
+/**
+ * Fixed size pool of worker threads for CPU side processing, i.e. image and mesh generation.
+ *
+ * Never call raylib functions that touch the graphics context or the window from a task.
+ */
+class ThreadPool {
+public:
+    /**
+     * Starts the worker threads, at least one.
+     */
+    explicit ThreadPool(unsigned int threadCount = std::thread::hardware_concurrency()) {
+        threadCount = threadCount > 0 ? threadCount : 1;
+        workers.reserve(threadCount);
+        for (unsigned int i = 0; i < threadCount; i++) {
+            workers.emplace_back([this] { Work(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Finishes the queued tasks and joins the worker threads.
+     */
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * Shared pool sized to the hardware concurrency, created on first use.
+     */
+    static ThreadPool& GetDefault() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    [[nodiscard]] size_t GetThreadCount() const { return workers.size(); }
+
+    /**
+     * Queues a task, the returned future holds its result or exception.
+     */
+    template<typename Function>
+    std::future<std::invoke_result_t<std::decay_t<Function>>> Submit(Function&& function) {
+        using Result = std::invoke_result_t<std::decay_t<Function>>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(function));
+        std::future<Result> result = task->get_future();
+        Enqueue([task] { (*task)(); });
+        return result;
+    }
+
+    /**
+     * Calls body(first, last) for consecutive ranges covering [0, count), at most grainSize items each.
+     *
+     * The calling thread processes ranges too, so this is safe to call from within a task. Blocks until all
+     * ranges are done and rethrows the first exception thrown by body.
+     */
+    template<typename Body>
+    void ParallelFor(size_t count, size_t grainSize, Body&& body) {
+        if (count == 0) {
+            return;
+        }
+        grainSize = grainSize > 0 ? grainSize : 1;
+        const size_t chunks = (count + grainSize - 1) / grainSize;
+        if (chunks == 1) {
+            body(size_t{0}, count);
+            return;
+        }
+
+        auto state = std::make_shared<ParallelForState>();
+        state->count = count;
+        state->grainSize = grainSize;
+        state->chunks = chunks;
+        state->body = [&body](size_t first, size_t last) { body(first, last); };
+
+        const size_t helpers = std::min(workers.size(), chunks - 1);
+        for (size_t i = 0; i < helpers; i++) {
+            Enqueue([state] { state->Run(); });
+        }
+        state->Run();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->finished.wait(lock, [&state] { return state->done == state->chunks; });
+        if (state->error) {
+            std::rethrow_exception(state->error);
+        }
+    }
+protected:
+    struct ParallelForState {
+        std::function<void(size_t, size_t)> body{};
+        size_t count{0};
+        size_t grainSize{1};
+        size_t chunks{0};
+        std::atomic<size_t> next{0};
+        size_t done{0};
+        std::exception_ptr error{};
+        std::mutex mutex{};
+        std::condition_variable finished{};
+
+        /**
+         * Claims and runs chunks until none are left. Late helpers find nothing to claim and never touch body.
+         */
+        void Run() {
+            for (size_t chunk = next.fetch_add(1); chunk < chunks; chunk = next.fetch_add(1)) {
+                const size_t first = chunk * grainSize;
+                const size_t last = std::min(first + grainSize, count);
+                std::exception_ptr chunkError;
+                try {
+                    body(first, last);
+                } catch (...) {
+                    chunkError = std::current_exception();
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                if (chunkError && !error) {
+                    error = chunkError;
+                }
+                if (++done == chunks) {
+                    finished.notify_all();
+                }
+            }
+        }
+    };
+
+    void Enqueue(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push(std::move(task));
+        }
+        condition.notify_one();
+    }
+
+    void Work() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this] { return stopping || !tasks.empty(); });
+                if (tasks.empty()) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> workers{};
+    std::queue<std::function<void()>> tasks{};
+    std::mutex mutex{};
+    std::condition_variable condition{};
+    bool stopping{false};
+};
+} // namespace raylib
+
+using RThreadPool = raylib::ThreadPool;
+
+#endif // RAYLIB_CPP_INCLUDE_THREADPOOL_HPP_
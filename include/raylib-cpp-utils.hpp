@@ -35,4 +35,14 @@
     }
 #endif
 
+#ifndef RAYLIB_CPP_NO_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+/**
+ * Defined when SSE2 intrinsics are available for the batch/SIMD code paths. Define RAYLIB_CPP_NO_SIMD to
+ * force the scalar fallbacks.
+ */
+#define RAYLIB_CPP_SSE2
+#endif
+#endif
+
 #endif // RAYLIB_CPP_INCLUDE_RAYLIB_CPP_UTILS_HPP_
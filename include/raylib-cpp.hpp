@@ -31,38 +31,66 @@
 #ifndef RAYLIB_CPP_INCLUDE_RAYLIB_CPP_HPP_
 #define RAYLIB_CPP_INCLUDE_RAYLIB_CPP_HPP_
 
+#include "./AABBTree.hpp"
+#include "./AnimationClip.hpp"
+#include "./AnimationPoseCache.hpp"
 #include "./AudioDevice.hpp"
 #include "./AudioStream.hpp"
 #include "./AutomationEventList.hpp"
 #include "./BoundingBox.hpp"
+#include "./BoundingSphere.hpp"
+#include "./BroadPhase.hpp"
 #include "./Camera2D.hpp"
 #include "./Camera3D.hpp"
+#include "./CollisionBatch.hpp"
 #include "./Color.hpp"
+#include "./ColorSpace.hpp"
 #include "./FileData.hpp"
 #include "./FileText.hpp"
+#include "./Frustum.hpp"
 #include "./Font.hpp"
 #include "./Functions.hpp"
 #include "./Gamepad.hpp"
 #include "./Image.hpp"
+#include "./ImageAnimStream.hpp"
+#include "./ImageCompare.hpp"
+#include "./InstanceCuller.hpp"
 #include "./Keyboard.hpp"
+#include "./LodModel.hpp"
+#include "./MappedFile.hpp"
+#include "./MappedModel.hpp"
 #include "./Material.hpp"
 #include "./Matrix.hpp"
 #include "./Mesh.hpp"
+#include "./MeshBVH.hpp"
+#include "./MeshBuilder.hpp"
+#include "./MeshClusters.hpp"
+#include "./MeshGenerator.hpp"
+#include "./MeshOptimizer.hpp"
 #include "./Model.hpp"
 #include "./ModelAnimation.hpp"
+#include "./ModelBinary.hpp"
+#include "./ModelLoadJob.hpp"
 #include "./Mouse.hpp"
 #include "./Music.hpp"
+#include "./PackedMesh.hpp"
 #include "./RadiansDegrees.hpp"
 #include "./Ray.hpp"
 #include "./RayCollision.hpp"
 #include "./RaylibException.hpp"
 #include "./Rectangle.hpp"
 #include "./RenderTexture.hpp"
+#include "./ResourceCache.hpp"
+#include "./SceneGraph.hpp"
 #include "./Shader.hpp"
+#include "./SkinningEngine.hpp"
 #include "./Sound.hpp"
+#include "./SpatialHash.hpp"
+#include "./SweptCollision.hpp"
 #include "./Text.hpp"
 #include "./Texture.hpp"
 #include "./TextureUnmanaged.hpp"
+#include "./ThreadPool.hpp"
 #include "./Touch.hpp"
 #include "./Vector2.hpp"
 #include "./Vector3.hpp"
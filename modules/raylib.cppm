@@ -45,33 +45,59 @@ export module raylib;
  */
 export namespace raylib {
     // Classes
+    using raylib::AABBTree;
+    using raylib::AnimationClip;
+    using raylib::AnimationPoseCache;
     using raylib::AudioDevice;
     using raylib::AudioStream;
     using raylib::AutomationEventList;
     using raylib::BoundingBox;
+    using raylib::BoundingSphere;
+    using raylib::BroadPhase;
     using raylib::Camera; // Alias for Camera3D
     using raylib::Camera2D;
     using raylib::Camera3D;
+    using raylib::CollisionBatch;
     using raylib::Color;
     using raylib::FileData;
     using raylib::FileText;
     using raylib::Font;
+    using raylib::Frustum;
     using raylib::Gamepad;
     using raylib::Image;
+    using raylib::ImageAnimStream;
+    using raylib::ImageCompare;
+    using raylib::InstanceCuller;
+    using raylib::LodModel;
+    using raylib::MappedFile;
+    using raylib::MappedModel;
     using raylib::Material;
     using raylib::Matrix;
     using raylib::Mesh;
+    using raylib::MeshBVH;
+    using raylib::MeshBuilder;
+    using raylib::MeshClusters;
+    using raylib::MeshGenerator;
+    using raylib::MeshOptimizer;
     using raylib::Model;
     using raylib::ModelAnimation;
+    using raylib::ModelBinary;
+    using raylib::ModelLoadJob;
     using raylib::Music;
+    using raylib::PackedMesh;
     using raylib::Ray;
     using raylib::RayCollision;
     using raylib::RaylibException;
     using raylib::Rectangle;
     using raylib::RenderTexture;
     using raylib::RenderTexture2D; // Alias for RenderTexture
+    using raylib::ResourceCache;
+    using raylib::SceneGraph;
     using raylib::Shader;
+    using raylib::SkinningEngine;
     using raylib::Sound;
+    using raylib::SpatialHash;
+    using raylib::SweptCollision;
     using raylib::Text;
     using raylib::Texture;
     using raylib::Texture2D; // Alias for Texture
@@ -79,6 +105,7 @@ export namespace raylib {
     using raylib::TextureUnmanaged;
     using raylib::Texture2DUnmanaged; // Alias for TextureUnmanaged
     using raylib::TextureCubemapUnmanaged; // Alias for TextureUnmanaged
+    using raylib::ThreadPool;
     using raylib::Vector2;
     using raylib::Vector3;
     using raylib::Vector4;
@@ -158,6 +185,14 @@ export namespace raylib {
     using raylib::TextToPascal;
     using raylib::TextToInteger;
 
+    /**
+     * @namespace raylib::literals
+     * @brief User-defined literals, such as `0xE62937FF_rgba`
+     */
+    namespace literals {
+        using raylib::literals::operator""_rgba;
+    }
+
     /**
      * @namespace raylib::Colors
      * @brief Re-exports all Color macros as inline constexpr
@@ -191,6 +226,21 @@ export namespace raylib {
         inline constexpr ::Color RAYWHITE = CLITERAL(::Color){ 245, 245, 245, 255 };
     }
 
+    /**
+     * @namespace raylib::ColorSpace
+     * @brief sRGB and linear light color conversions
+     */
+    namespace ColorSpace {
+        using raylib::ColorSpace::SrgbToLinearExact;
+        using raylib::ColorSpace::LinearToSrgbExact;
+        using raylib::ColorSpace::GetSrgbToLinearTable;
+        using raylib::ColorSpace::GetLinearToSrgbTable;
+        using raylib::ColorSpace::SrgbToLinear;
+        using raylib::ColorSpace::LinearToSrgb;
+        using raylib::ColorSpace::ToLinear;
+        using raylib::ColorSpace::FromLinear;
+    }
+
     /**
      * @namespace raylib::Keyboard
      * @brief Input-related functions: keyboard
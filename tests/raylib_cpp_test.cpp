@@ -1,5 +1,7 @@
 #include "raylib-assert.h"
 #include "raylib-cpp.hpp"
+#include <cstdio>
+#include <filesystem>
 #include <string>
 #include <vector>
 
@@ -62,6 +64,28 @@ int main(int argc, char* argv[]) {
         color = RAYWHITE;
         ::Color raylibColor = RAYWHITE;
         AssertEqual(color.r, raylibColor.r);
+
+        // Compile-time colors
+        using namespace raylib::literals;
+        constexpr raylib::Color palette[] = {raylib::Color::Red(), 0xE62937FF_rgba, raylib::Color::FromHSV(120, 1, 1)};
+        static_assert(palette[0] == palette[1]);
+        static_assert(palette[0].Fade(0.5f).a == 127);
+        AssertEqual(palette[1].ToInt(), ::ColorToInt(::GetColor(0xE62937FF)));
+        Assert(palette[2] == ::ColorFromHSV(120, 1, 1));
+        Assert(raylib::Color::Red().Lerp(BLUE, 0.5f) == ::ColorLerp(RED, BLUE, 0.5f));
+    }
+
+    // ColorSpace
+    {
+        for (int i = 0; i < 256; i++) {
+            const auto value = static_cast<unsigned char>(i);
+            AssertEqual(raylib::ColorSpace::LinearToSrgb(raylib::ColorSpace::SrgbToLinear(value)), value);
+        }
+
+        // A linear-light midpoint between black and white is brighter than the sRGB byte midpoint.
+        raylib::Color gray = raylib::Color::Black().LerpGammaCorrect(WHITE, 0.5f);
+        AssertEqual(gray.r, 188);
+        AssertEqual(gray.a, 255);
     }
 
     // Math
@@ -81,6 +105,839 @@ int main(int argc, char* argv[]) {
         image.Crop(100, 100).Resize(50, 50);
         AssertEqual(image.GetWidth(), 50);
         AssertEqual(image.GetHeight(), 50);
+
+        // Gamma correct downsampling of a black and white checkerboard averages to mid gray in linear light
+        raylib::Image checked(::GenImageChecked(4, 4, 1, 1, BLACK, WHITE));
+        checked.ResizeGammaCorrect(1, 1);
+        AssertEqual(checked.GetColor().r, 188);
+
+        // Each texel of the 2x2 level averages two black and two white texels
+        raylib::Image mipmapped(::GenImageChecked(4, 4, 1, 1, BLACK, WHITE));
+        mipmapped.MipmapsGammaCorrect();
+        AssertEqual(mipmapped.GetMipmaps(), 3);
+        AssertEqual(static_cast<const unsigned char*>(mipmapped.data)[4 * 4 * 4], 188);
+    }
+
+    // ImageAnimStream
+    {
+        // Two 2x2 frames: red, then green and blue.
+        unsigned char gif[] = {
+            0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x02, 0x00, 0x02, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+            0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x21, 0xF9, 0x04, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x2C,
+            0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x02, 0x02, 0x8C, 0x53, 0x00, 0x21, 0xF9, 0x04,
+            0x00, 0x0A, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x02, 0x03,
+            0xD4, 0x26, 0x05, 0x00, 0x3B};
+        const std::string animFile = (std::filesystem::temp_directory_path() / "raylib-cpp-test-anim.gif").string();
+        ::SaveFileData(animFile.c_str(), gif, sizeof(gif));
+
+        raylib::ImageAnimStream anim(animFile);
+        AssertEqual(anim.GetFrameCount(), 2);
+        AssertEqual(anim.GetFrameDelay(1), 0.1f);
+        AssertEqual(anim.GetImage().GetColor(0, 0).r, 255);
+        anim.Next();
+        AssertEqual(anim.GetImage().GetColor(0, 0).g, 255);
+        AssertEqual(anim.GetImage().GetColor(1, 0).b, 255);
+        AssertEqual(anim.Next().GetColor(1, 1).r, 255);
+
+        // A corrupt LZW code size in the first frame, one wider than the 8-bit color indices, and frames without a
+        // color table once the previous file's is gone
+        std::vector<std::string> brokenFiles;
+        const auto saveBroken = [&brokenFiles](const char* name, std::vector<unsigned char> data) {
+            brokenFiles.push_back((std::filesystem::temp_directory_path() / name).string());
+            ::SaveFileData(brokenFiles.back().c_str(), data.data(), static_cast<int>(data.size()));
+        };
+        std::vector<unsigned char> corrupt(gif, gif + sizeof(gif));
+        corrupt[43] = 0x0F;
+        saveBroken("raylib-cpp-test-corrupt.gif", corrupt);
+        corrupt[43] = 0x09;
+        saveBroken("raylib-cpp-test-wide.gif", corrupt);
+        std::vector<unsigned char> uncolored(gif, gif + sizeof(gif));
+        uncolored[10] = 0x00;
+        uncolored.erase(uncolored.begin() + 13, uncolored.begin() + 25);
+        saveBroken("raylib-cpp-test-uncolored.gif", uncolored);
+        for (const std::string& fileName : brokenFiles) {
+            int thrown = 0;
+            try {
+                raylib::ImageAnimStream broken(fileName);
+            } catch (raylib::RaylibException&) {
+                thrown++;
+            }
+            try {
+                anim.Load(fileName);
+            } catch (raylib::RaylibException&) {
+                thrown++;
+            }
+            AssertEqual(thrown, 2, "Expected a corrupt GIF to throw");
+            AssertNot(anim.IsValid());
+        }
+        std::filesystem::remove(animFile);
+        for (const std::string& fileName : brokenFiles) {
+            std::filesystem::remove(fileName);
+        }
+
+        // Other formats are loaded as a whole
+        raylib::ImageAnimStream still(path + "/resources/feynman.png");
+        AssertEqual(still.GetFrameCount(), 1);
+    }
+
+    // Image::GenerateSDF()
+    {
+        raylib::Image square(::GenImageColor(32, 32, BLANK));
+        square.DrawRectangle(8, 8, 16, 16, WHITE);
+        square.GenerateSDF(4.0f);
+        AssertEqual(square.GetFormat(), PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+        AssertEqual(square.GetColor(16, 16).r, 255);
+        AssertEqual(square.GetColor(0, 0).r, 0);
+        AssertEqual(square.GetColor(8, 16).r, 143);
+    }
+
+    // ThreadPool
+    {
+        raylib::ThreadPool pool(2);
+        std::vector<int> values(1000, 1);
+        pool.ParallelFor(values.size(), 64, [&values](size_t first, size_t last) {
+            for (size_t i = first; i < last; i++) {
+                values[i] *= 2;
+            }
+        });
+        AssertEqual(std::count(values.begin(), values.end(), 2), 1000);
+        AssertEqual(pool.Submit([] { return 42; }).get(), 42);
+    }
+
+    // ImageCompare
+    {
+        raylib::Image expected(::GenImageColor(16, 16, RED));
+        raylib::Image actual(::GenImageColor(16, 16, RED));
+        actual.DrawPixel(3, 4, {235, 41, 55, 255});
+
+        raylib::ImageCompare compare(expected, actual);
+        raylib::ImageCompare::Result result = compare.Compare();
+        AssertEqual(result.maxError[0], 5);
+        AssertEqual(result.maxError[1], 0);
+        AssertEqual(result.differentPixels, 1);
+        Assert(compare.IsWithin(5));
+        AssertNot(compare.IsWithin(4));
+        Assert(compare.GetSSIM() > 0.99f);
+        Assert(std::isinf(raylib::ImageCompare(expected, expected).Compare().psnr));
+
+        raylib::Image heatmap(compare.GenHeatmap(10.0f));
+        AssertEqual(heatmap.GetColor(3, 4).r, 50);
+    }
+
+    // MeshBuilder
+    {
+        raylib::MeshBuilder builder(4, 2);
+        std::span<raylib::Vector3> positions = builder.Positions();
+        positions[1] = raylib::Vector3(1, 0, 0);
+        positions[2] = raylib::Vector3(0, 0, 1);
+        positions[3] = raylib::Vector3(1, 0, 1);
+        const unsigned short quad[] = {0, 2, 1, 1, 2, 3};
+        std::ranges::copy(quad, builder.Indices().begin());
+
+        raylib::Mesh mesh(builder.Build());
+        AssertEqual(mesh.GetVertexCount(), 4);
+        AssertEqual(mesh.GetIndices()[5], 3);
+        AssertEqual(mesh.GetVertices()[9], 1.0f);
+        Assert(mesh.GetNormals() == nullptr);
+        AssertEqual(builder.GetVertexCount(), 0);
+
+        // Too many vertices for 16-bit indices: the mesh is de-indexed
+        raylib::MeshBuilder large(70000, 1);
+        large.Positions()[69999] = raylib::Vector3(5, 6, 7);
+        std::span<unsigned int> indices = large.Indices32();
+        indices[0] = 69999;
+        raylib::Mesh deindexed(large.Build());
+        AssertEqual(deindexed.GetVertexCount(), 3);
+        Assert(deindexed.GetIndices() == nullptr);
+        AssertEqual(deindexed.GetVertices()[2], 7.0f);
+
+        // An index past the last vertex is rejected rather than read out of bounds
+        raylib::MeshBuilder broken(70000, 1);
+        broken.Positions();
+        broken.Indices32()[2] = 70000;
+        bool rejected = false;
+        try {
+            (void)broken.Build();
+        } catch (raylib::RaylibException&) {
+            rejected = true;
+        }
+        Assert(rejected);
+        AssertEqual(broken.GetVertexCount(), 70000);
+    }
+
+    // MeshGenerator
+    {
+        raylib::Mesh grid(raylib::MeshGenerator::Grid(2, 2, 4, 3, 1.0f, false));
+        AssertEqual(grid.GetVertexCount(), 20);
+        AssertEqual(grid.GetTriangleCount(), 24);
+        AssertEqual(grid.GetVertices()[0], -1.0f);
+
+        const float heights[] = {0, 0, 0, 0, 1, 0, 0, 0, 0};
+        raylib::Mesh terrain(raylib::MeshGenerator::Heightmap(heights, 3, 3, {2, 1, 2}, false));
+        AssertEqual(terrain.GetVertices()[13], 1.0f);
+        AssertEqual(terrain.GetNormals()[13], 1.0f);
+
+        raylib::Mesh sphere(raylib::MeshGenerator::Sphere(1.0f, 8, 16, false));
+        AssertEqual(sphere.GetTriangleCount(), 16 * 7 * 2);
+        AssertEqual(sphere.GetVertices()[1], 1.0f);
+
+        // Past 65536 vertices the indices no longer fit in 16 bits, and the sphere is de-indexed
+        raylib::Mesh dense(raylib::MeshGenerator::Sphere(1.0f, 256, 256, false));
+        AssertEqual(dense.GetTriangleCount(), 256 * 255 * 2);
+        AssertEqual(dense.GetVertexCount(), dense.GetTriangleCount() * 3);
+        Assert(dense.GetIndices() == nullptr);
+        AssertEqual(dense.GetVertices()[dense.GetVertexCount() * 3 - 2], -1.0f);
+    }
+
+    // LodModel
+    {
+        // A sphere with a bounding sphere of radius sqrt(3), seen through a 90 degree field of view
+        raylib::LodModel lod;
+        lod.AddLevel(raylib::MeshGenerator::Sphere(1.0f, 4, 8, false).LoadModelFrom(), 0.25f);
+        lod.AddLevel(raylib::MeshGenerator::Sphere(1.0f, 16, 32, false).LoadModelFrom(), 0.5f);
+        lod.AddLevel(raylib::MeshGenerator::Sphere(1.0f, 2, 4, false).LoadModelFrom(), 0.125f);
+        AssertEqual(lod.GetLevelCount(), 3);
+        AssertEqual(lod.GetLevelScreenSize(0), 0.5f);
+
+        const raylib::Camera3D camera({0, 0, 0}, {0, 0, -1}, {0, 1, 0}, 90.0f);
+        Assert(std::fabs(lod.GetScreenSize(camera, {0, 0, -10}) - std::sqrt(3.0f) / 10.0f) < 0.0001f);
+        AssertEqual(lod.GetScreenSize(camera, {0, 0, -1}), 1.0f);
+        const raylib::Camera3D ortho({0, 0, 0}, {0, 0, -1}, {0, 1, 0}, 10.0f, CAMERA_ORTHOGRAPHIC);
+        Assert(std::fabs(lod.GetScreenSize(ortho, {0, 0, -100}, 2.0f) - 4.0f * std::sqrt(3.0f) / 10.0f) < 0.0001f);
+
+        AssertEqual(lod.SelectLevel(camera, {0, 0, -2}), 0);
+        AssertEqual(lod.SelectLevel(camera, {0, 0, -5}), 1);
+        AssertEqual(lod.SelectLevel(camera, {0, 0, -10}), 2);
+        AssertEqual(lod.SelectLevel(camera, {0, 0, -100}), 2);
+        AssertEqual(lod.SelectLevel(camera, {0, 0, -5}, 4.0f), 0);
+
+        // Just past the 0.5 threshold the previous level stays, further out or in it changes
+        AssertEqual(lod.SelectLevel(camera, {0, 0, -3.6f}), 1);
+        AssertEqual(lod.SelectLevel(camera, {0, 0, -3.6f}, 1.0f, 0), 0);
+        AssertEqual(lod.SelectLevel(camera, {0, 0, -4.0f}, 1.0f, 0), 1);
+        AssertEqual(lod.SelectLevel(camera, {0, 0, -3.3f}), 0);
+        AssertEqual(lod.SelectLevel(camera, {0, 0, -3.3f}, 1.0f, 1), 1);
+        AssertEqual(lod.SelectLevel(camera, {0, 0, -3.0f}, 1.0f, 1), 0);
+        AssertEqual(lod.SelectLevel(camera, {0, 0, -10}, 1.0f, 0), 2);
+
+        // Swaying across the threshold keeps the level Draw() selects, until the distance leaves the hysteresis
+        AssertEqual(lod.GetLastLevel(), -1);
+        AssertEqual(lod.UpdateLevel(camera, {0, 0, -3.3f}), 0);
+        for (int i = 0; i < 4; i++) {
+            AssertEqual(lod.UpdateLevel(camera, {0, 0, i % 2 == 0 ? -3.6f : -3.4f}), 0);
+        }
+        AssertEqual(lod.UpdateLevel(camera, {0, 0, -4.0f}), 1);
+        for (int i = 0; i < 4; i++) {
+            AssertEqual(lod.UpdateLevel(camera, {0, 0, i % 2 == 0 ? -3.3f : -3.6f}), 1);
+        }
+        AssertEqual(lod.GetLastLevel(), 1);
+        lod.SetHysteresis(0.0f);
+        AssertEqual(lod.SelectLevel(camera, {0, 0, -3.6f}, 1.0f, 0), 1);
+    }
+
+    // MeshOptimizer
+    {
+        raylib::MeshBuilder builder(6, 2);
+        std::span<raylib::Vector3> positions = builder.Positions();
+        positions[0] = positions[3] = raylib::Vector3(0, 0, 0);
+        positions[1] = raylib::Vector3(0, 0, 1);
+        positions[2] = positions[4] = raylib::Vector3(1, 0, 1);
+        positions[5] = raylib::Vector3(1, 0, 0);
+        raylib::Mesh quad(builder.Build());
+        quad.Weld();
+        AssertEqual(quad.GetVertexCount(), 4);
+        AssertEqual(quad.GetIndices()[3], 0);
+        AssertEqual(quad.GetIndices()[5], 3);
+
+        raylib::Mesh sphere(raylib::MeshGenerator::Sphere(1.0f, 16, 32, false));
+        const float acmr = sphere.AnalyzeVertexCache().acmr;
+        sphere.Optimize();
+        AssertEqual(sphere.GetTriangleCount(), 32 * 15 * 2);
+        Assert(sphere.AnalyzeVertexCache().acmr < acmr);
+        AssertEqual(sphere.GetIndices()[0], 0);
+    }
+
+    // MeshOptimizer::Simplify()
+    {
+        raylib::Mesh sphere(raylib::MeshGenerator::Sphere(1.0f, 32, 32, false));
+        const int triangleCount = sphere.GetTriangleCount();
+        sphere.Simplify(0.25f, 0.05f);
+        Assert(sphere.GetTriangleCount() <= triangleCount / 4);
+        Assert(sphere.GetTriangleCount() > 0);
+    }
+
+    // MeshClusters
+    {
+        raylib::Mesh grid(raylib::MeshGenerator::Grid(16, 16, 32, 32, 1.0f, false));
+        raylib::MeshClusters clusters(grid);
+        Assert(clusters.GetClusterCount() >= 2048 / 124);
+        for (const raylib::MeshClusters::Cluster& cluster : clusters.GetClusters()) {
+            Assert(cluster.vertexCount <= 64 && cluster.indexCount <= 124 * 3);
+        }
+
+        // Looking down at the corner of the grid from above, and from below where every cluster faces away
+        ::Matrix projection = MatrixPerspective(60 * DEG2RAD, 1.0, 0.1, 100.0);
+        ::Matrix view = MatrixLookAt({-6, 4, -6}, {-6, 0, -6}, {0, 0, 1});
+        std::vector<raylib::MeshClusters::IndexRange> ranges;
+        const size_t visible = clusters.Cull(raylib::Frustum(MatrixMultiply(view, projection)), {-6, 4, -6}, ranges);
+        Assert(visible > 0 && visible < clusters.GetClusterCount());
+        view = MatrixLookAt({-6, -4, -6}, {-6, 0, -6}, {0, 0, 1});
+        AssertEqual(clusters.Cull(raylib::Frustum(MatrixMultiply(view, projection)), {-6, -4, -6}, ranges), 0);
+        AssertEqual(ranges.size(), 0);
+    }
+
+    // PackedMesh
+    {
+        raylib::Mesh sphere(raylib::MeshGenerator::Sphere(2.0f, 8, 8, false));
+        raylib::PackedMesh packed(sphere);
+        Assert(packed.GetDataSize() < sizeof(float) * 8 * static_cast<size_t>(sphere.GetVertexCount()));
+        raylib::Mesh unpacked(packed.Unpack());
+        AssertEqual(unpacked.GetVertexCount(), sphere.GetVertexCount());
+        Assert(std::fabs(unpacked.GetVertices()[4] - sphere.GetVertices()[4]) < 0.001f);
+        Assert(std::fabs(unpacked.GetNormals()[1] - sphere.GetNormals()[1]) < 0.001f);
+        AssertEqual(unpacked.GetTexCoords()[2], 0.125f);
+
+        AssertEqual(raylib::PackedMesh::HalfToFloat(raylib::PackedMesh::FloatToHalf(-2.5f)), -2.5f);
+    }
+
+    // BoundingBox::Transform()
+    {
+        const float points[] = {1, 2, 3, -1, 0, 5, 2, -2, 4, 0, 1, 1, 3, 3, 3};
+        raylib::BoundingBox box = raylib::BoundingBox::FromPoints(points, 5);
+        AssertEqual(box.min.x, -1.0f);
+        AssertEqual(box.max.x, 3.0f);
+        AssertEqual(box.min.y, -2.0f);
+        AssertEqual(box.max.z, 5.0f);
+
+        raylib::BoundingBox moved = box.Transform(MatrixMultiply(MatrixScale(2, 2, 2), MatrixTranslate(1, 0, 0)));
+        AssertEqual(moved.min.x, -1.0f);
+        AssertEqual(moved.max.x, 7.0f);
+        AssertEqual(moved.max.z, 10.0f);
+
+        raylib::Mesh sphere(raylib::MeshGenerator::Sphere(1.0f, 8, 8, false));
+        Assert(std::fabs(sphere.GetBoundingSphere().radius - 1.0f) < 0.001f);
+        raylib::BoundingBox rotated = sphere.GetTransformedBoundingBox(MatrixRotateY(0.5f));
+        Assert(rotated.max.x >= 1.0f && rotated.min.x <= -1.0f);
+
+        // Unmanaged meshes cache their box too, until the vertices are set or invalidated
+        float vertices[] = {0, 0, 0, 1, 1, 1};
+        float moreVertices[] = {0, 0, 0, 2, 2, 2};
+        raylib::MeshUnmanaged unmanaged;
+        unmanaged.SetVertices(vertices);
+        unmanaged.SetVertexCount(2);
+        AssertEqual(unmanaged.BoundingBox().max.x, 1.0f);
+        vertices[3] = 4.0f;
+        AssertEqual(unmanaged.GetTransformedBoundingBox(MatrixTranslate(1, 0, 0)).max.x, 2.0f);
+        unmanaged.InvalidateBounds();
+        AssertEqual(unmanaged.BoundingBox().max.x, 4.0f);
+        unmanaged.SetVertices(moreVertices);
+        AssertEqual(unmanaged.GetTransformedBoundingBox(MatrixTranslate(1, 0, 0)).max.x, 3.0f);
+    }
+
+    // SkinningEngine
+    {
+        float vertices[] = {1, 2, 3};
+        float normals[] = {0, 1, 0};
+        float animVertices[3] = {};
+        float animNormals[3] = {};
+        unsigned char boneIds[] = {0, 1, 0, 0};
+        float boneWeights[] = {0.5f, 0.5f, 0, 0};
+        ::Mesh mesh{};
+        mesh.vertexCount = 1;
+        mesh.vertices = vertices;
+        mesh.normals = normals;
+        mesh.animVertices = animVertices;
+        mesh.animNormals = animNormals;
+        mesh.boneIds = boneIds;
+        mesh.boneWeights = boneWeights;
+        ::Model model{};
+        model.meshCount = 1;
+        model.meshes = &mesh;
+
+        const ::Matrix pose[] = {MatrixTranslate(2, 0, 0), MatrixScale(1, 3, 1)};
+        raylib::SkinningEngine skinning;
+        skinning.Update(model, pose, false);
+        AssertEqual(animVertices[0], 2.0f);
+        AssertEqual(animVertices[1], 4.0f);
+        Assert(std::fabs(animNormals[1] - 2.0f / 3.0f) < 0.0001f);
+        AssertEqual(skinning.GetSkinnedMeshCount(), 1);
+        skinning.Update(model, pose, false);
+        AssertEqual(skinning.GetSkippedMeshCount(), 1);
+
+        bool shared = false;
+        const raylib::SkinningEngine::Instance instances[] = {{&model, nullptr, 0, pose}, {&model, nullptr, 0, pose}};
+        try {
+            skinning.Update(instances, false);
+        } catch (raylib::RaylibException&) {
+            shared = true;
+        }
+        Assert(shared, "Instances sharing a model should be rejected");
+
+        // Animation frames match ::UpdateModelAnimationBones()
+        ::Transform bindPose[] = {
+            {{0, 1, 0}, {0, 0, 0, 1}, {1, 1, 1}},
+            {{0, 2, 0}, QuaternionFromAxisAngle({0, 0, 1}, 0.5f), {1, 2, 1}}};
+        ::Transform frame[] = {
+            {{1, 1, 0}, QuaternionFromAxisAngle({0, 1, 0}, 1.0f), {2, 2, 2}},
+            {{0, 3, 1}, QuaternionFromAxisAngle({1, 0, 0}, -0.7f), {1, 1, 3}}};
+        ::Transform* framePoses[] = {frame};
+        ::BoneInfo bones[2]{};
+        ::ModelAnimation animation{};
+        animation.boneCount = 2;
+        animation.frameCount = 1;
+        animation.bones = bones;
+        animation.framePoses = framePoses;
+        model.boneCount = 2;
+        model.bones = bones;
+        model.bindPose = bindPose;
+        ::Matrix boneMatrices[2]{};
+        mesh.boneMatrices = boneMatrices;
+        mesh.boneCount = 2;
+
+        ::Matrix expected[2]{};
+        ::Mesh reference{};
+        reference.boneMatrices = expected;
+        reference.boneCount = 2;
+        ::Model referenceModel = model;
+        referenceModel.meshes = &reference;
+        ::UpdateModelAnimationBones(referenceModel, animation, 0);
+
+        ::Matrix computed[2]{};
+        raylib::SkinningEngine::ComputeBoneMatrices(model, animation, 0, computed);
+        skinning.Update(model, animation, 0, false);
+        for (size_t bone = 0; bone < 2; bone++) {
+            const float16 a = MatrixToFloatV(expected[bone]);
+            const float16 b = MatrixToFloatV(computed[bone]);
+            const float16 c = MatrixToFloatV(boneMatrices[bone]);
+            for (size_t i = 0; i < 16; i++) {
+                Assert(std::fabs(a.v[i] - b.v[i]) < 0.0001f, "ComputeBoneMatrices() should match raylib");
+                Assert(std::fabs(a.v[i] - c.v[i]) < 0.0001f, "Update() should sync Mesh::boneMatrices");
+            }
+        }
+        const ::Vector3 position = Vector3Add(
+            Vector3Scale(Vector3Transform({1, 2, 3}, expected[0]), 0.5f),
+            Vector3Scale(Vector3Transform({1, 2, 3}, expected[1]), 0.5f));
+        Assert(std::fabs(animVertices[0] - position.x) < 0.0001f);
+        Assert(std::fabs(animVertices[1] - position.y) < 0.0001f);
+        Assert(std::fabs(animVertices[2] - position.z) < 0.0001f);
+    }
+
+    // AnimationClip
+    {
+        std::vector<::Transform> frames(30);
+        std::vector<::Transform*> framePoses(frames.size());
+        for (size_t i = 0; i < frames.size(); i++) {
+            frames[i] = {{static_cast<float>(i), 0, 0}, {0, 0, 0, 1}, {1, 1, 1}};
+            framePoses[i] = &frames[i];
+        }
+        ::ModelAnimation animation{};
+        animation.boneCount = 1;
+        animation.frameCount = static_cast<int>(frames.size());
+        animation.framePoses = framePoses.data();
+
+        raylib::AnimationClip clip(animation, 30.0f);
+        AssertEqual(clip.GetKeyCount(), 4);
+        AssertEqual(clip.GetDuration(), 1.0f);
+        ::Transform pose[1];
+        clip.Sample(2.5f / 30.0f, pose);
+        Assert(std::fabs(pose[0].translation.x - 2.5f) < 0.001f);
+        Assert(std::fabs(pose[0].rotation.w - 1.0f) < 0.001f);
+        raylib::AnimationClip::Blend(clip, 0.0f, clip, 10.0f / 30.0f, 0.5f, pose);
+        Assert(std::fabs(pose[0].translation.x - 5.0f) < 0.001f);
+    }
+
+    // AnimationPoseCache
+    {
+        ::Transform bindPose[] = {{{0, 0, 0}, {0, 0, 0, 1}, {1, 1, 1}}};
+        ::Transform bindPoseCopy[] = {bindPose[0]};
+        ::Transform frames[] = {{{1, 0, 0}, {0, 0, 0, 1}, {1, 1, 1}}, {{2, 0, 0}, {0, 0, 0, 1}, {1, 1, 1}}};
+        ::Transform* framePoses[] = {&frames[0], &frames[1]};
+        ::ModelAnimation animation{};
+        animation.boneCount = 1;
+        animation.frameCount = 2;
+        animation.framePoses = framePoses;
+        ::Model first{};
+        first.boneCount = 1;
+        first.bindPose = bindPose;
+        ::Model second = first;
+        second.bindPose = bindPoseCopy;
+
+        raylib::AnimationPoseCache poses;
+        AssertEqual(poses.Get(first, animation, 3)[0].m12, 2.0f);
+        AssertEqual(poses.Get(second, animation, 1).data(), poses.Get(first, animation, 1).data());
+        AssertEqual(poses.GetMissCount(), 1);
+        AssertEqual(poses.GetHitCount(), 2);
+
+        const raylib::AnimationPoseCache::Instance instances[] = {{&animation, 0}, {&animation, 1}, {&animation, 0}};
+        int offsets[3];
+        AssertEqual(poses.BuildPalette(first, instances, offsets).size(), 2);
+        AssertEqual(offsets[2], 0);
+        AssertEqual(offsets[1], 1);
+
+        poses.NextFrame();
+        poses.NextFrame();
+        AssertEqual(poses.GetPoseCount(), 0);
+
+        // A pose that failed to compute is not cached
+        animation.boneCount = 2;
+        int failures = 0;
+        for (int i = 0; i < 2; i++) {
+            try {
+                poses.Get(first, animation, 0);
+            } catch (raylib::RaylibException&) {
+                failures++;
+            }
+        }
+        AssertEqual(failures, 2);
+        AssertEqual(poses.GetPoseCount(), 0);
+    }
+
+    // ModelBinary
+    {
+        float vertices[] = {0, 0, 0, 1, 0, 0, 0, 1, 0};
+        unsigned short indices[] = {0, 1, 2};
+        ::Mesh mesh{};
+        mesh.vertexCount = 3;
+        mesh.triangleCount = 1;
+        mesh.vertices = vertices;
+        mesh.indices = indices;
+        ::Model model{};
+        model.transform = MatrixIdentity();
+        model.meshCount = 1;
+        model.meshes = &mesh;
+
+        const std::string file = (std::filesystem::temp_directory_path() / "raylib-cpp-test.rlmodel").string();
+        raylib::ModelBinary::Export(model, file, 42);
+        AssertEqual(raylib::ModelBinary::GetSourceHash(file), 42);
+        ::Model loaded = raylib::ModelBinary::Load(file, true, false);
+        AssertEqual(loaded.meshCount, 1);
+        AssertEqual(loaded.meshes[0].vertexCount, 3);
+        Assert(memcmp(loaded.meshes[0].vertices, vertices, sizeof(vertices)) == 0);
+        Assert(memcmp(loaded.meshes[0].indices, indices, sizeof(indices)) == 0);
+        ::UnloadModel(loaded);
+        raylib::Model reloaded;
+        reloaded.LoadBinary(file);
+        AssertEqual(reloaded.meshes[0].triangleCount, 1);
+
+        // The vertex count requires positions
+        mesh.vertices = nullptr;
+        raylib::ModelBinary::Export(model, file, 42);
+        bool rejected = false;
+        try {
+            loaded = raylib::ModelBinary::Load(file, true, false);
+        } catch (raylib::RaylibException&) {
+            rejected = true;
+        }
+        Assert(rejected, "A mesh without positions should be rejected");
+        std::filesystem::remove(file);
+    }
+
+    // ModelLoadJob
+    {
+        float vertices[] = {0, 0, 0, 1, 0, 0, 0, 1, 0};
+        ::Mesh mesh{};
+        mesh.vertexCount = 3;
+        mesh.triangleCount = 1;
+        mesh.vertices = vertices;
+        ::Model model{};
+        model.transform = MatrixIdentity();
+        model.meshCount = 1;
+        model.meshes = &mesh;
+        const std::string file = (std::filesystem::temp_directory_path() / "raylib-cpp-test-job.rlmodel").string();
+        raylib::ModelBinary::Export(model, file, 0);
+
+        int uploads = 0;
+        raylib::ModelLoadJob::Uploader uploader;
+        uploader.mesh = [&uploads](::Mesh&, bool) { uploads++; };
+        raylib::ModelLoadJob job(file, uploader);
+        while (!job.Update(0.0f)) {
+        }
+        AssertEqual(uploads, 1);
+        AssertEqual(job.GetProgress(), 1.0f);
+        ::Model loaded = job.Take();
+        AssertEqual(loaded.meshes[0].vertexCount, 3);
+        ::UnloadModel(loaded);
+
+        // Other formats need a cache directory, whose conversion a worker finds and parses
+        const std::filesystem::path directory = std::filesystem::temp_directory_path();
+        const std::string source = (directory / "raylib-cpp-test-job.obj").string();
+        const unsigned char sourceData[] = "v 0 0 0";
+        ::SaveFileData(source.c_str(), const_cast<unsigned char*>(sourceData), sizeof(sourceData));
+        bool rejected = false;
+        try {
+            raylib::Model::LoadAsync(source);
+        } catch (raylib::RaylibException&) {
+            rejected = true;
+        }
+        Assert(rejected, "A model to convert should need a cache directory");
+
+        uint64_t sourceHash = 0;
+        const std::string cacheFile = raylib::ModelBinary::GetCacheFile(source, directory.string(), sourceHash);
+        raylib::ModelBinary::Export(model, cacheFile, sourceHash);
+        raylib::ModelLoadJob cached(source, directory.string(), uploader);
+        while (!cached.Update(0.0f)) {
+        }
+        AssertEqual(uploads, 2);
+        loaded = cached.Take();
+        AssertEqual(loaded.meshes[0].vertexCount, 3);
+        ::UnloadModel(loaded);
+        std::filesystem::remove(file);
+        std::filesystem::remove(source);
+        std::filesystem::remove(cacheFile);
+    }
+
+    // ResourceCache
+    {
+        raylib::ResourceCache<raylib::Image> images;
+        images.Alias("portrait", path + "/resources/feynman.png");
+        std::shared_ptr<raylib::Image> image = images.Get(path + "/resources/feynman.png");
+        AssertEqual(images.Get("portrait").get(), image.get());
+        AssertEqual(images.GetMissCount(), 1);
+        AssertEqual(images.GetHitCount(), 1);
+        AssertEqual(images.GetMemoryUsage(), raylib::ResourceCache<raylib::Image>::GetResourceSize(*image));
+
+        images.SetMemoryBudget(0);
+        AssertEqual(images.GetCount(), 1);
+        image.reset();
+        images.Trim();
+        AssertEqual(images.GetCount(), 0);
+        AssertEqual(images.GetEvictionCount(), 1);
+    }
+
+    // InstanceCuller
+    {
+        const raylib::Camera3D camera({0, 0, 0}, {0, 0, -1}, {0, 1, 0}, 60.0f);
+        const raylib::Frustum frustum(camera, 16.0f / 9.0f);
+        const ::BoundingBox bounds{{-1, -1, -1}, {1, 1, 1}};
+        const ::Matrix transforms[] = {
+            MatrixTranslate(0, 0, -10),
+            MatrixTranslate(0, 0, 10),
+            MatrixTranslate(100, 0, -10),
+            MatrixTranslate(0, 0, -2000),
+            MatrixTranslate(0, 0, -999.5f)};
+
+        raylib::InstanceCuller culler;
+        std::span<const ::Matrix> visible = culler.Cull(frustum, bounds, transforms);
+        AssertEqual(visible.size(), 2);
+        AssertEqual(visible[0].m14, -10.0f);
+        AssertEqual(culler.GetCulledCount(), 3);
+    }
+
+    // SceneGraph
+    {
+        raylib::SceneGraph scene;
+        raylib::SceneGraph::Node root = scene.Create({}, MatrixTranslate(1, 0, 0));
+        raylib::SceneGraph::Node child = scene.Create(root, MatrixTranslate(0, 2, 0));
+        raylib::SceneGraph::Node leaf = scene.Create(child, MatrixTranslate(0, 0, 3));
+        raylib::SceneGraph::Node other = scene.Create();
+        scene.Update();
+        AssertEqual(scene.GetUpdatedCount(), 4);
+        AssertEqual(scene.GetWorldTransform(leaf).m12, 1.0f);
+        AssertEqual(scene.GetWorldTransform(leaf).m14, 3.0f);
+
+        scene.SetLocalTransform(child, MatrixTranslate(0, 5, 0));
+        scene.Update();
+        AssertEqual(scene.GetUpdatedCount(), 2);
+        AssertEqual(scene.GetWorldTransform(leaf).m13, 5.0f);
+        Assert(!scene.HasChanged(root));
+
+        scene.SetParent(child, other);
+        scene.Update();
+        AssertEqual(scene.GetWorldTransform(leaf).m12, 0.0f);
+
+        scene.Remove(child);
+        scene.Update();
+        AssertEqual(scene.GetNodeCount(), 2);
+        Assert(!scene.IsValid(leaf));
+    }
+
+    // MeshBVH
+    {
+        float vertices[] = {-1, -1, 0, 1, -1, 0, 0, 1, 0, -1, -1, 5, 1, -1, 5, 0, 1, 5};
+        ::Mesh mesh{};
+        mesh.vertexCount = 6;
+        mesh.triangleCount = 2;
+        mesh.vertices = vertices;
+        raylib::MeshBVH bvh(mesh);
+        AssertEqual(bvh.GetTriangleCount(), 2);
+
+        int triangle = -1;
+        const ::RayCollision hit = bvh.GetCollision(::Ray{{0, 0, 10}, {0, 0, -1}}, FLT_MAX, &triangle);
+        Assert(hit.hit);
+        AssertEqual(hit.distance, 5.0f);
+        AssertEqual(triangle, 1);
+        Assert(bvh.CheckCollision(::Ray{{0, 0, -10}, {0, 0, 1}}));
+        Assert(!bvh.CheckCollision(::Ray{{0, 0, 10}, {0, 0, -1}}, 4.0f));
+        Assert(!bvh.GetCollision(::Ray{{5, 0, 10}, {0, 0, -1}}).hit);
+
+        std::vector<int> overlapping;
+        AssertEqual(bvh.GetOverlapping(::Vector3{0, 0, 0.5f}, 1.0f, overlapping), 1);
+        AssertEqual(overlapping[0], 0);
+
+        // Axis aligned rays along the cell boundaries, where the slab test computes 0 * inf
+        raylib::Mesh floor(raylib::MeshGenerator::Grid(16, 16, 16, 16, 1.0f, false));
+        const raylib::MeshBVH floorBVH(floor);
+        const ::Ray down[] = {{{1, 5, 0.5f}, {0, -1, 0}}, {{1, 5, 1}, {0, -1, 0}}, {{-3, 5, 2}, {0, -1, 0}}};
+        ::RayCollision collisions[3];
+        floorBVH.GetCollisions(down, collisions);
+        for (size_t i = 0; i < 3; i++) {
+            Assert(floorBVH.CheckCollision(down[i]), "A ray on a cell boundary should hit the floor");
+            AssertEqual(floorBVH.GetCollision(down[i]).distance, 5.0f);
+            Assert(collisions[i].hit);
+            AssertEqual(collisions[i].distance, 5.0f);
+        }
+    }
+
+    // SpatialHash and AABBTree
+    {
+        raylib::SpatialHash<::Rectangle> grid(4.0f);
+        raylib::AABBTree<::Rectangle> tree;
+        const ::Rectangle a{0, 0, 3, 3};
+        const ::Rectangle b{2, 2, 3, 3};
+        const ::Rectangle c{10, 10, 1, 1};
+        const int gridIds[] = {grid.Insert(a), grid.Insert(b), grid.Insert(c)};
+        const int treeIds[] = {tree.Insert(a), tree.Insert(b), tree.Insert(c)};
+
+        std::vector<std::pair<int, int>> pairs;
+        AssertEqual(grid.GetPairs(pairs), 1);
+        AssertEqual(tree.GetPairs(pairs), 1);
+
+        grid.Update(gridIds[2], ::Rectangle{4, 4, 1, 1});
+        tree.Update(treeIds[2], ::Rectangle{4, 4, 1, 1});
+        pairs.clear();
+        AssertEqual(grid.GetPairs(pairs), 2);
+        AssertEqual(tree.GetPairs(pairs), 2);
+
+        std::vector<int> found;
+        AssertEqual(grid.Query(::Rectangle{-1, -1, 1.5f, 1.5f}, found), 1);
+        AssertEqual(tree.Query(::Rectangle{-1, -1, 1.5f, 1.5f}, found), 1);
+        AssertEqual(found[0], gridIds[0]);
+        AssertEqual(found[1], treeIds[0]);
+
+        grid.Remove(gridIds[1]);
+        tree.Remove(treeIds[1]);
+        pairs.clear();
+        AssertEqual(grid.GetPairs(pairs), 0);
+        AssertEqual(tree.GetPairs(pairs), 0);
+        AssertEqual(tree.GetCount(), 2);
+    }
+
+    // CollisionBatch
+    {
+        raylib::CollisionBatch batch;
+        for (int i = 0; i < 6; i++) {
+            const auto x = static_cast<float>(i * 3);
+            batch.AddBox(::BoundingBox{{x, -1, -1}, {x + 1, 1, 1}});
+            batch.AddSphere(::Vector3{x, 5, 0}, 1.0f);
+        }
+        std::vector<uint32_t> mask(raylib::CollisionBatch::GetMaskSize(batch.GetBoxCount()));
+        std::vector<float> distances(batch.GetBoxCount());
+
+        AssertEqual(batch.GetRayBoxCollisions(::Ray{{-2, 0, 0}, {1, 0, 0}}, mask, distances), 6);
+        AssertEqual(distances[0], 2.0f);
+        AssertEqual(distances[5], 17.0f);
+        AssertEqual(batch.GetRayBoxCollisions(::Ray{{-2, 0, 0}, {1, 0, 0}}, mask, distances, 10.0f), 3);
+        Assert(!raylib::CollisionBatch::IsHit(mask, 3));
+
+        AssertEqual(batch.GetRaySphereCollisions(::Ray{{3, 5, 10}, {0, 0, -1}}, mask, distances), 1);
+        Assert(raylib::CollisionBatch::IsHit(mask, 1));
+        AssertEqual(distances[1], 9.0f);
+
+        // A ray without a direction misses every sphere, and still overwrites the distances
+        std::fill(distances.begin(), distances.end(), 1.0f);
+        AssertEqual(batch.GetRaySphereCollisions(::Ray{{3, 5, 10}, {0, 0, 0}}, mask, distances), 0);
+        AssertEqual(distances[0], FLT_MAX);
+        AssertEqual(distances[5], FLT_MAX);
+
+        AssertEqual(batch.CheckBoxCollisions(::BoundingBox{{2, 0, 0}, {6.5f, 3, 3}}, mask), 2);
+        AssertEqual(batch.CheckBoxSphereCollisions(::BoundingBox{{2, 0, 0}, {6.5f, 3, 3}}, mask), 0);
+
+        const ::Ray rays[] = {{{0.5f, 0, -5}, {0, 0, 1}}, {{0.5f, 5, -5}, {0, 0, 1}}, {{0.5f, 0, 0}, {0, 1, 0}}};
+        AssertEqual(raylib::CollisionBatch::GetRayCollisions(rays, batch.GetBox(0), mask, distances), 2);
+        AssertEqual(distances[2], 1.0f);
+    }
+
+    // SweptCollision
+    {
+        // A thin wall the box jumps over in one step, which a discrete check misses
+        const raylib::BoundingBox bullet(::Vector3{-1, -0.5f, -0.5f}, ::Vector3{0, 0.5f, 0.5f});
+        const ::BoundingBox wall{{10, -5, -5}, {10.5f, 5, 5}};
+        Assert(!raylib::BoundingBox(::Vector3{99, -0.5f, -0.5f}, ::Vector3{100, 0.5f, 0.5f}).CheckCollision(wall));
+        raylib::RayCollision hit = bullet.GetSweptCollision(::Vector3{100, 0, 0}, wall);
+        Assert(hit.hit);
+        AssertEqual(hit.distance, 0.1f);
+        AssertEqual(hit.normal.x, -1.0f);
+
+        // Resting on the floor it slides along freely, but cannot move into it
+        const raylib::BoundingBox crate(::Vector3{0, 0, 0}, ::Vector3{1, 1, 1});
+        const ::BoundingBox floor{{-10, -1, -10}, {10, 0, 10}};
+        Assert(!crate.GetSweptCollision(::Vector3{5, 0, 0}, floor).hit);
+        hit = crate.GetSweptCollision(::Vector3{1, -1, 0}, floor);
+        Assert(hit.hit);
+        AssertEqual(hit.distance, 0.0f);
+        AssertEqual(hit.normal.y, 1.0f);
+
+        hit = raylib::Rectangle(0, 0, 2, 2).GetSweptCollision(::Vector2{0, 50}, ::Rectangle{-5, 20, 10, 1});
+        AssertEqual(hit.distance, 0.36f);
+        AssertEqual(hit.normal.y, -1.0f);
+
+        // Spheres against the rounded edges of a box, hitting one and passing another's corner
+        const ::BoundingBox pillar{{0, 0, -5}, {1, 1, 5}};
+        hit = raylib::BoundingSphere(::Vector3{-3, -3, 0}, 1).GetSweptCollision(::Vector3{3, 3, 0}, pillar);
+        Assert(hit.hit);
+        Assert(std::fabs(hit.distance - (1.0f - 1.0f / (3.0f * std::sqrt(2.0f)))) < 0.0001f);
+        Assert(std::fabs(hit.normal.x + std::sqrt(0.5f)) < 0.0001f);
+        Assert(!raylib::SweptCollision::Sweep(::Vector3{-2, 0.2f, 0}, 1, ::Vector3{2, -2, 0}, pillar).hit);
+
+        // Spheres against a triangle's face and corner, and a point against its face
+        const ::Vector3 p1{-1, 0, -1};
+        const ::Vector3 p2{1, 0, -1};
+        const ::Vector3 p3{0, 0, 1};
+        hit = raylib::SweptCollision::Sweep(::Vector3{0, 5, 0}, 1, ::Vector3{0, -10, 0}, p1, p2, p3);
+        AssertEqual(hit.distance, 0.4f);
+        AssertEqual(hit.normal.y, 1.0f);
+        hit = raylib::SweptCollision::Sweep(::Vector3{0, 0, 4}, 1, ::Vector3{0, 0, -4}, p1, p2, p3);
+        AssertEqual(hit.distance, 0.5f);
+        AssertEqual(hit.normal.z, 1.0f);
+        AssertEqual(raylib::SweptCollision::Cast(::Vector3{0, 5, 0}, ::Vector3{0, -10, 0}, p1, p2, p3).distance, 0.5f);
+
+        // Points against a sphere and a box, touching their surfaces
+        hit = raylib::SweptCollision::Cast(::Vector3{-5, 0, 0}, ::Vector3{10, 0, 0}, ::Vector3{0, 0, 0}, 1);
+        Assert(hit.hit);
+        AssertEqual(hit.distance, 0.4f);
+        AssertEqual(hit.point.x, -1.0f);
+        AssertEqual(hit.normal.x, -1.0f);
+        Assert(!raylib::SweptCollision::Cast(::Vector3{-5, 2, 0}, ::Vector3{10, 0, 0}, ::Vector3{0, 0, 0}, 1).hit);
+        hit = raylib::SweptCollision::Cast(::Vector3{-5, 0.5f, 0.5f}, ::Vector3{10, 0, 0}, pillar);
+        Assert(hit.hit);
+        AssertEqual(hit.distance, 0.5f);
+        AssertEqual(hit.point.x, 0.0f);
+        AssertEqual(hit.normal.x, -1.0f);
+        Assert(!raylib::SweptCollision::Cast(::Vector3{-5, 2, 0}, ::Vector3{10, 0, 0}, pillar).hit);
+    }
+
+    // Frustum
+    {
+        const raylib::Camera3D camera({0, 0, 0}, {0, 0, -1}, {0, 1, 0}, 60.0f);
+        const raylib::Frustum frustum = camera.GetFrustum(16.0f / 9.0f);
+        Assert(frustum.IsPointVisible({0, 0, -10}));
+        Assert(!frustum.IsPointVisible({0, 0, 10}));
+        AssertEqual(frustum.GetPlane(raylib::Frustum::Near).z, -1.0f);
+
+        std::vector<::BoundingBox> boxes;
+        std::vector<raylib::BoundingSphere> spheres;
+        for (int i = 0; i < 6; i++) {
+            // Every other one behind the camera
+            const float z = i % 2 == 0 ? -10.0f * static_cast<float>(i + 1) : 10.0f;
+            boxes.push_back({{-1, -1, z - 1}, {1, 1, z + 1}});
+            spheres.emplace_back(::Vector3{0, 0, z}, 1.0f);
+        }
+        std::vector<uint32_t> visible(raylib::CollisionBatch::GetMaskSize(boxes.size()));
+        AssertEqual(frustum.CullBoxes(boxes, visible), 3);
+        AssertEqual(visible[0], 0b010101u);
+        AssertEqual(frustum.CullSpheres(spheres, visible), 3);
+        Assert(raylib::CollisionBatch::IsHit(visible, 4));
+        Assert(!raylib::CollisionBatch::IsHit(visible, 5));
     }
 
     // Keyboard